@@ -0,0 +1,122 @@
+// ---------------------------------------------------------------------------+
+//					This file is part of SLS AVR Library
+//				https://github.com/SimonLitt/sls-avr-lib
+// ---------------------------------------------------------------------------+
+// Copyright (C) 2025 Simon Litt <simon@1itt.net> https://coding.1itt.net,
+// 												  https://github.com/SimonLitt
+//
+// This program is free software: you can redistribute it and/or modify it
+// under the terms of the GNU General Public License as published by the Free
+// Software Foundation, version 3.
+//
+// This program is distributed in the hope that it will be useful, but WITHOUT
+// ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+// FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License for
+// more details.
+//
+// You should have received a copy of the GNU General Public License along
+// with this program. If not, see <https://www.gnu.org/licenses/>.
+// ---------------------------------------------------------------------------+
+/**
+ * \author		Simon Litt <simon@1itt.net> https://coding.1itt.net,
+ *              							https://github.com/SimonLitt
+ * \copyright	GNU General Public License v3.0
+ * \file		sls-avr/lcd_bar.h
+ * \brief		Horizontal bar graphs with the resolution of a symbol column.
+ * \details		Built on top of sls-avr/lcd_hd44780_pin.h and uses the same configuration. In multidisplay mode the functions that output take the #lcd_info_t reference first.
+ *
+ * The partially filled cells are custom symbols with 1-5 lit columns. When the value changes, only the cells that look different are sent, usually one or two at the end of the bar.
+ *
+ * \code
+ * #include <sls-avr/lcd_bar.h>
+ * ...
+ * static lcd_bar_t level = LCD_BAR(LCD_ROW_2, 0, 16);
+ *
+ * int main(void) {
+ *		...
+ *		lcd_init(&cfg);
+ *		lcd_bar_init();
+ *		while (1) {
+ *			...
+ *			lcd_bar(&level, adc_value, 1023);
+ *		}
+ * }
+ * \endcode
+ */
+#ifndef SLS_AVR_LCD_BAR_H_
+#define SLS_AVR_LCD_BAR_H_
+
+#include <stdbool.h>
+#include <stdint.h>
+#include <sls-avr/lcd_hd44780_pin.h>
+
+#ifndef LCD_BAR_CENTER_ZERO
+#	define LCD_BAR_CENTER_ZERO		0 /**< \brief Enables #lcd_bar_center(). \details The bars take all the 8 CGRAM slots then, the full cell is #LCD_BAR_FULL_CHAR. */
+#endif // LCD_BAR_CENTER_ZERO
+
+#ifndef LCD_BAR_FIRST_SLOT
+#	define LCD_BAR_FIRST_SLOT		0 /**< \brief The first of 5 CGRAM slots used by the bars, 0-3. \details Not used with #LCD_BAR_CENTER_ZERO or #LCD_HD44780_PIN_GLYPH_CACHE, the cache pins the slots itself. */
+#endif // LCD_BAR_FIRST_SLOT
+
+#ifndef LCD_BAR_FULL_CHAR
+#	define LCD_BAR_FULL_CHAR		0xFF /**< \brief The full block symbol of the character generator ROM, used with #LCD_BAR_CENTER_ZERO. */
+#endif // LCD_BAR_FULL_CHAR
+
+#if !LCD_BAR_CENTER_ZERO && (LCD_BAR_FIRST_SLOT > 3)
+#	error "LCD_BAR_FIRST_SLOT should be in range 0-3!"
+#endif
+
+#define LCD_BAR_CELL_STEPS			5 /**< \brief Number of the bar steps per cell */
+
+/** \brief Bar state */
+typedef struct {
+	uint8_t row; /**< \brief Display row, #lcd_line_t */
+	uint8_t col; /**< \brief The first display column */
+	uint8_t width; /**< \brief Bar width in cells */
+	int16_t level; /**< \brief The drawn number of the lit columns, negative to the left of the centre */
+	bool valid; /**< \brief The display shows #level */
+} lcd_bar_t;
+
+/**
+ * \brief Defines a #lcd_bar_t
+ * \param _row Display row
+ * \param _col The first display column
+ * \param _width Bar width in cells. A centre-zero bar has a half of it for each sign.
+ */
+#define LCD_BAR(_row, _col, _width)		{.row = (_row), .col = (_col), .width = (_width), .level = 0, .valid = false}
+
+/**
+ * \brief Uploads the bar symbols to CGRAM, should be called after #lcd_init()
+ * \param info #lcd_info_t reference, multidisplay mode only.
+ * \return false if #LCD_HD44780_PIN_GLYPH_CACHE could not pin all the symbols, because the other code has pinned the slots. Nothing is pinned then and the bars should not be drawn.
+ */
+bool lcd_bar_init(__LCD_MULTIMODE_ONLY_INFO_ARG(info));
+
+/**
+ * \brief Draws a bar from the left, only the changed cells are sent
+ * \param info #lcd_info_t reference, multidisplay mode only.
+ * \param bar Bar state
+ * \param value Value, greater values are drawn as max
+ * \param max The value of the full bar, not 0
+ */
+void lcd_bar(__LCD_MULTIMODE_ONLY_INFO_ARG_WITH_COMMA(info) lcd_bar_t *const bar, const uint16_t value, const uint16_t max);
+
+#if LCD_BAR_CENTER_ZERO || __DOXYGEN__
+/**
+ * \brief Draws a bar from the centre, to the left for the negative values, only the changed cells are sent
+ * \details See #LCD_BAR_CENTER_ZERO
+ * \param info #lcd_info_t reference, multidisplay mode only.
+ * \param bar Bar state
+ * \param value Value -max..max, greater values are drawn as max
+ * \param max The value of the full half of the bar, not 0
+ */
+void lcd_bar_center(__LCD_MULTIMODE_ONLY_INFO_ARG_WITH_COMMA(info) lcd_bar_t *const bar, const int16_t value, const uint16_t max);
+#endif // LCD_BAR_CENTER_ZERO
+
+/**
+ * \brief Forces the whole bar to be sent by the next draw, e.g. after #lcd_clear()
+ * \param bar Bar state
+ */
+void lcd_bar_invalidate(lcd_bar_t *const bar);
+
+#endif /* SLS_AVR_LCD_BAR_H_ */
@@ -0,0 +1,125 @@
+// ---------------------------------------------------------------------------+
+//					This file is part of SLS AVR Library
+//				https://github.com/SimonLitt/sls-avr-lib
+// ---------------------------------------------------------------------------+
+// Copyright (C) 2025 Simon Litt <simon@1itt.net> https://coding.1itt.net,
+// 												  https://github.com/SimonLitt
+//
+// This program is free software: you can redistribute it and/or modify it
+// under the terms of the GNU General Public License as published by the Free
+// Software Foundation, version 3.
+//
+// This program is distributed in the hope that it will be useful, but WITHOUT
+// ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+// FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License for
+// more details.
+//
+// You should have received a copy of the GNU General Public License along
+// with this program. If not, see <https://www.gnu.org/licenses/>.
+// ---------------------------------------------------------------------------+
+/**
+ * \author		Simon Litt <simon@1itt.net> https://coding.1itt.net,
+ *              							https://github.com/SimonLitt
+ * \copyright	GNU General Public License v3.0
+ * \file		sls-avr/lcd_big.h
+ * \brief		Big digits of 3 columns and 2 or 3 rows for numeric readouts.
+ * \details		Built on top of sls-avr/lcd_hd44780_pin.h and uses the same configuration. In multidisplay mode the functions that output take the #lcd_info_t reference first.
+ *
+ * The digits are composed like the seven-segment ones from 4 custom symbols for 2 rows or 6 custom symbols for 3 rows. A digit takes 3 columns and a blank one after it, the point is drawn in the blank column of the last integer digit.
+ * Only the digits that have changed since the last draw are sent.
+ *
+ * \code
+ * #include <sls-avr/lcd_big.h>
+ * ...
+ * static lcd_big_t counter = LCD_BIG(LCD_ROW_1, 0);
+ *
+ * int main(void) {
+ *		...
+ *		lcd_init(&cfg);
+ *		lcd_big_init();
+ *		while (1) {
+ *			...
+ *			lcd_big_u16(&counter, count, 5);
+ *		}
+ * }
+ * \endcode
+ */
+#ifndef SLS_AVR_LCD_BIG_H_
+#define SLS_AVR_LCD_BIG_H_
+
+#include <stdbool.h>
+#include <stdint.h>
+#include <sls-avr/lcd_hd44780_pin.h>
+
+#ifndef LCD_BIG_DIGIT_ROWS
+#	define LCD_BIG_DIGIT_ROWS		2 /**< \brief Digit height, 2 or 3 rows. */
+#endif // LCD_BIG_DIGIT_ROWS
+
+#if (LCD_BIG_DIGIT_ROWS != 2) && (LCD_BIG_DIGIT_ROWS != 3)
+#	error "LCD_BIG_DIGIT_ROWS should be 2 or 3!"
+#endif
+
+#ifndef LCD_BIG_FIRST_SLOT
+#	define LCD_BIG_FIRST_SLOT		0 /**< \brief The first CGRAM slot of the digit symbols, 4 slots are used for 2 rows and 6 for 3 rows. \details Not used with #LCD_HD44780_PIN_GLYPH_CACHE, the cache pins the slots itself. */
+#endif // LCD_BIG_FIRST_SLOT
+
+#if LCD_BIG_FIRST_SLOT > (8 - ((LCD_BIG_DIGIT_ROWS == 2) ? 4 : 6))
+#	error "The big digit symbols do not fit CGRAM from LCD_BIG_FIRST_SLOT!"
+#endif
+
+#ifndef LCD_BIG_MAX_DIGITS
+#	define LCD_BIG_MAX_DIGITS		6 /**< \brief Maximum number of digit positions of a readout. */
+#endif // LCD_BIG_MAX_DIGITS
+
+#define LCD_BIG_DIGIT_PITCH			4 /**< \brief Columns per digit position including the blank one */
+
+/** \brief Readout state */
+typedef struct {
+	uint8_t row; /**< \brief The top display row, #lcd_line_t */
+	uint8_t col; /**< \brief The first display column */
+	byte_t shown[LCD_BIG_MAX_DIGITS]; /**< \brief The drawn symbol of each position */
+	bool valid; /**< \brief The display shows #shown */
+} lcd_big_t;
+
+/**
+ * \brief Defines a #lcd_big_t
+ * \param _row The top display row
+ * \param _col The first display column
+ */
+#define LCD_BIG(_row, _col)		{.row = (_row), .col = (_col), .valid = false}
+
+/**
+ * \brief Uploads the digit symbols to CGRAM, should be called after #lcd_init()
+ * \param info #lcd_info_t reference, multidisplay mode only.
+ * \return false if #LCD_HD44780_PIN_GLYPH_CACHE could not pin all the symbols, because the other code has pinned the slots. Nothing is pinned then and the readouts should not be drawn.
+ */
+bool lcd_big_init(__LCD_MULTIMODE_ONLY_INFO_ARG(info));
+
+/**
+ * \brief Draws an unsigned number, right-aligned with blank leading positions
+ * \details Only the changed positions are sent. All the positions show a minus if the number does not fit.
+ * \param info #lcd_info_t reference, multidisplay mode only.
+ * \param big Readout state
+ * \param value A number
+ * \param digits Number of the digit positions, up to #LCD_BIG_MAX_DIGITS, nothing is drawn for 0. It should be the same for all the calls with the readout.
+ */
+void lcd_big_u16(__LCD_MULTIMODE_ONLY_INFO_ARG_WITH_COMMA(info) lcd_big_t *const big, const uint16_t value, const uint8_t digits);
+
+/**
+ * \brief Draws a fixed-point number, see #lcd_big_u16()
+ * \details The minus takes a position. The point is placed before the last frac_digits positions, a zero is kept before it.
+ * \param info #lcd_info_t reference, multidisplay mode only.
+ * \param big Readout state
+ * \param value The number multiplied by 10<sup>frac_digits</sup>
+ * \param frac_digits Number of the fractional digits, less than digits, greater values are limited. It should be the same for all the calls with the readout.
+ * \param digits Number of the digit positions, up to #LCD_BIG_MAX_DIGITS
+ */
+void lcd_big_fixed(__LCD_MULTIMODE_ONLY_INFO_ARG_WITH_COMMA(info) lcd_big_t *const big, const int32_t value, const uint8_t frac_digits, const uint8_t digits);
+
+/**
+ * \brief Forces the whole readout to be sent by the next draw, e.g. after #lcd_clear()
+ * \param big Readout state
+ */
+void lcd_big_invalidate(lcd_big_t *const big);
+
+#endif /* SLS_AVR_LCD_BIG_H_ */
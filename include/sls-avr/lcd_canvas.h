@@ -0,0 +1,144 @@
+// ---------------------------------------------------------------------------+
+//					This file is part of SLS AVR Library
+//				https://github.com/SimonLitt/sls-avr-lib
+// ---------------------------------------------------------------------------+
+// Copyright (C) 2025 Simon Litt <simon@1itt.net> https://coding.1itt.net,
+// 												  https://github.com/SimonLitt
+//
+// This program is free software: you can redistribute it and/or modify it
+// under the terms of the GNU General Public License as published by the Free
+// Software Foundation, version 3.
+//
+// This program is distributed in the hope that it will be useful, but WITHOUT
+// ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+// FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License for
+// more details.
+//
+// You should have received a copy of the GNU General Public License along
+// with this program. If not, see <https://www.gnu.org/licenses/>.
+// ---------------------------------------------------------------------------+
+/**
+ * \author		Simon Litt <simon@1itt.net> https://coding.1itt.net,
+ *              							https://github.com/SimonLitt
+ * \copyright	GNU General Public License v3.0
+ * \file		sls-avr/lcd_canvas.h
+ * \brief		A small pixel canvas tiled over the custom symbols.
+ * \details		Built on top of sls-avr/lcd_hd44780_pin.h and uses the same configuration. In multidisplay mode the functions that output take the #lcd_info_t reference first.
+ *
+ * The canvas is #LCD_CANVAS_COLS x #LCD_CANVAS_ROWS cells of 5x8 pixels, 20x16 pixels by default. The drawing functions change only the canvas in RAM and mark the changed glyph rows,
+ * #lcd_canvas_flush() uploads them to CGRAM. The consecutive changed rows go after a single address command, including the rows of the next slot.
+ *
+ * \code
+ * #include <sls-avr/lcd_canvas.h>
+ * ...
+ * static lcd_canvas_t plot;
+ *
+ * int main(void) {
+ *		...
+ *		lcd_init(&cfg);
+ *		lcd_canvas_init(&plot);
+ *		lcd_canvas_place(LCD_ROW_1, 16);
+ *		while (1) {
+ *			...
+ *			lcd_canvas_clear(&plot);
+ *			for (uint8_t x = 1; x < LCD_CANVAS_WIDTH; x++) {
+ *				lcd_canvas_line(&plot, x - 1, trend[x - 1], x, trend[x], true);
+ *			}
+ *			lcd_canvas_flush(&plot);
+ *		}
+ * }
+ * \endcode
+ *
+ * \remark #lcd_canvas_flush() leaves the address counter in CGRAM like #lcd_custom_char(), so the DDRAM address should be set before the text output.
+ */
+#ifndef SLS_AVR_LCD_CANVAS_H_
+#define SLS_AVR_LCD_CANVAS_H_
+
+#include <stdbool.h>
+#include <stdint.h>
+#include <sls-avr/lcd_hd44780_pin.h>
+
+#ifndef LCD_CANVAS_COLS
+#	define LCD_CANVAS_COLS			4 /**< \brief Canvas width in display columns */
+#endif // LCD_CANVAS_COLS
+
+#ifndef LCD_CANVAS_ROWS
+#	define LCD_CANVAS_ROWS			2 /**< \brief Canvas height in display rows */
+#endif // LCD_CANVAS_ROWS
+
+#ifndef LCD_CANVAS_FIRST_SLOT
+#	define LCD_CANVAS_FIRST_SLOT	0 /**< \brief The first CGRAM slot of the canvas, the cells take the slots in rows from the top left one. */
+#endif // LCD_CANVAS_FIRST_SLOT
+
+#define LCD_CANVAS_CELLS			(LCD_CANVAS_COLS * LCD_CANVAS_ROWS) /**< \brief Number of the CGRAM slots taken by the canvas */
+#define LCD_CANVAS_WIDTH			(LCD_CANVAS_COLS * 5) /**< \brief Canvas width in pixels */
+#define LCD_CANVAS_HEIGHT			(LCD_CANVAS_ROWS * 8) /**< \brief Canvas height in pixels */
+
+#if (LCD_CANVAS_FIRST_SLOT + LCD_CANVAS_CELLS) > 8
+#	error "The canvas does not fit CGRAM from LCD_CANVAS_FIRST_SLOT!"
+#endif
+
+#if LCD_HD44780_PIN_GLYPH_CACHE
+#	error "The canvas can't share CGRAM with LCD_HD44780_PIN_GLYPH_CACHE, the cache can replace any unpinned slot!"
+#endif
+
+/** \brief Canvas state */
+typedef struct {
+	byte_t bits[LCD_CANVAS_CELLS][8]; /**< \brief Glyph rows of the cells */
+	byte_t dirty[LCD_CANVAS_CELLS]; /**< \brief Glyph rows changed since the last upload, a bit per row */
+} lcd_canvas_t;
+
+/**
+ * \brief Clears the canvas and marks it for the whole upload
+ * \param canvas Canvas state
+ */
+void lcd_canvas_init(lcd_canvas_t *const canvas);
+
+/**
+ * \brief Writes the canvas cell symbols to the display
+ * \param info #lcd_info_t reference, multidisplay mode only.
+ * \param line The top display row
+ * \param pos The left display column
+ */
+void lcd_canvas_place(__LCD_MULTIMODE_ONLY_INFO_ARG_WITH_COMMA(info) const lcd_line_t line, const uint8_t pos);
+
+/**
+ * \brief Turns all the pixels off
+ * \param canvas Canvas state
+ */
+void lcd_canvas_clear(lcd_canvas_t *const canvas);
+
+/**
+ * \brief Sets a pixel, the pixels out of the canvas are ignored
+ * \param canvas Canvas state
+ * \param x Column from the left, 0 - #LCD_CANVAS_WIDTH - 1
+ * \param y Row from the top, 0 - #LCD_CANVAS_HEIGHT - 1
+ * \param on Pixel state
+ */
+void lcd_canvas_set_pixel(lcd_canvas_t *const canvas, const uint8_t x, const uint8_t y, const bool on);
+
+/**
+ * \brief Draws a line including both the ends, see #lcd_canvas_set_pixel()
+ * \param canvas Canvas state
+ * \param x0 Start column
+ * \param y0 Start row
+ * \param x1 End column
+ * \param y1 End row
+ * \param on Pixel state
+ */
+void lcd_canvas_line(lcd_canvas_t *const canvas, const uint8_t x0, const uint8_t y0, const uint8_t x1, const uint8_t y1, const bool on);
+
+/**
+ * \brief Uploads the changed glyph rows to CGRAM
+ * \param info #lcd_info_t reference, multidisplay mode only.
+ * \param canvas Canvas state
+ */
+void lcd_canvas_flush(__LCD_MULTIMODE_ONLY_INFO_ARG_WITH_COMMA(info) lcd_canvas_t *const canvas);
+
+/**
+ * \brief Forces the whole canvas to be uploaded by the next flush, e.g. after #lcd_init()
+ * \param canvas Canvas state
+ */
+void lcd_canvas_invalidate(lcd_canvas_t *const canvas);
+
+#endif /* SLS_AVR_LCD_CANVAS_H_ */
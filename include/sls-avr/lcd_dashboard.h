@@ -0,0 +1,125 @@
+// ---------------------------------------------------------------------------+
+//					This file is part of SLS AVR Library
+//				https://github.com/SimonLitt/sls-avr-lib
+// ---------------------------------------------------------------------------+
+// Copyright (C) 2025 Simon Litt <simon@1itt.net> https://coding.1itt.net,
+// 												  https://github.com/SimonLitt
+//
+// This program is free software: you can redistribute it and/or modify it
+// under the terms of the GNU General Public License as published by the Free
+// Software Foundation, version 3.
+//
+// This program is distributed in the hope that it will be useful, but WITHOUT
+// ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+// FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License for
+// more details.
+//
+// You should have received a copy of the GNU General Public License along
+// with this program. If not, see <https://www.gnu.org/licenses/>.
+// ---------------------------------------------------------------------------+
+/**
+ * \author		Simon Litt <simon@1itt.net> https://coding.1itt.net,
+ *              							https://github.com/SimonLitt
+ * \copyright	GNU General Public License v3.0
+ * \file		sls-avr/lcd_dashboard.h
+ * \brief		Display fields bound to variables, redrawn only when the values change.
+ * \details		Built on top of sls-avr/lcd_hd44780_pin.h and uses the same configuration. In multidisplay mode the functions take the #lcd_info_t reference first.
+ *
+ * \code
+ * #include <sls-avr/lcd_dashboard.h>
+ * ...
+ * volatile int16_t temp; // 0.1 degree, updated by an interrupt
+ * uint16_t rpm;
+ * const char *mode_label; // Points to a PSTR()
+ *
+ * static const __flash lcd_field_t fields[] = {
+ *		LCD_FIELD(temp, LCD_FIELD_I16, LCD_ROW_1, 6, 5, 1, ' ', 10),
+ *		LCD_FIELD(rpm, LCD_FIELD_U16, LCD_ROW_2, 4, 5, 0, ' ', 0),
+ *		LCD_FIELD(mode_label, LCD_FIELD_STR_P, LCD_ROW_2, 12, 4, 0, ' ', 0),
+ * };
+ * static lcd_field_state_t fields_state[3];
+ *
+ * int main(void) {
+ *		...
+ *		lcd_refresh_ml_P(PSTR("Temp:\nRPM:"));
+ *		lcd_dashboard_invalidate(fields_state, 3);
+ *		while (1) {
+ *			...
+ *			lcd_dashboard_poll(fields, fields_state, 3, ticks); // Only the changed fields are sent
+ *		}
+ * }
+ * \endcode
+ */
+#ifndef SLS_AVR_LCD_DASHBOARD_H_
+#define SLS_AVR_LCD_DASHBOARD_H_
+
+#include <stdbool.h>
+#include <stdint.h>
+#include <sls-avr/lcd_hd44780_pin.h>
+
+#ifndef LCD_DASHBOARD_ATOMIC
+#	define LCD_DASHBOARD_ATOMIC		1 /**< \brief The bound variables are read with interrupts disabled, so the values changed by interrupts are never torn. */
+#endif // LCD_DASHBOARD_ATOMIC
+
+/** \brief Type of a bound variable */
+typedef enum {
+	LCD_FIELD_U8 = 0, /**< \brief uint8_t */
+	LCD_FIELD_U16, /**< \brief uint16_t */
+	LCD_FIELD_I16, /**< \brief int16_t */
+	LCD_FIELD_U32, /**< \brief uint32_t, with the fractional digits up to INT32_MAX */
+	LCD_FIELD_I32, /**< \brief int32_t */
+	LCD_FIELD_STR_P, /**< \brief <tt>const char *</tt> to a program memory string, e.g. one of the state labels. The field is redrawn when the pointer changes. */
+} lcd_field_type_t;
+
+/** \brief A field description, usually placed in flash */
+typedef struct {
+	const volatile void *var; /**< \brief The bound variable */
+	uint8_t type; /**< \brief #lcd_field_type_t */
+	uint8_t row; /**< \brief Display row, #lcd_line_t */
+	uint8_t col; /**< \brief Display column */
+	uint8_t width; /**< \brief Field width. The numbers are right-aligned and not truncated, the strings are truncated and padded with spaces. */
+	uint8_t frac_digits; /**< \brief Number of the fractional digits, see #lcd_put_fixed() */
+	char pad; /**< \brief Padding symbol of the numbers */
+	uint16_t min_ticks; /**< \brief Minimum number of ticks between two redraws of the field, 0 for none */
+} lcd_field_t;
+
+/** \brief The last drawn state of a field */
+typedef struct {
+	uint32_t last; /**< \brief The last drawn value */
+	uint16_t stamp; /**< \brief The tick of the last redraw */
+	bool valid; /**< \brief The display shows #last */
+} lcd_field_state_t;
+
+/**
+ * \brief Defines a #lcd_field_t
+ * \param _var The bound variable
+ * \param _type #lcd_field_type_t
+ * \param _row Display row
+ * \param _col Display column
+ * \param _width Field width
+ * \param _frac Number of the fractional digits
+ * \param _pad Padding symbol
+ * \param _min_ticks Minimum number of ticks between two redraws
+ */
+#define LCD_FIELD(_var, _type, _row, _col, _width, _frac, _pad, _min_ticks) \
+	{.var = &(_var), .type = (_type), .row = (_row), .col = (_col), .width = (_width), .frac_digits = (_frac), .pad = (_pad), .min_ticks = (_min_ticks)}
+
+/**
+ * \brief Redraws the fields whose variables have changed since the last redraw
+ * \details A changed field is redrawn not earlier than lcd_field_t::min_ticks after the previous redraw, the change is not lost meanwhile. The unchanged fields cost no display bus time.
+ * \param info #lcd_info_t reference, multidisplay mode only.
+ * \param fields Field descriptions
+ * \param state Field states, one per field
+ * \param count Number of fields
+ * \param now Current time in any ticks, e.g. a timer interrupt counter. It may wrap.
+ */
+void lcd_dashboard_poll(__LCD_MULTIMODE_ONLY_INFO_ARG_WITH_COMMA(info) const __flash lcd_field_t fields[], lcd_field_state_t state[], const uint8_t count, const uint16_t now);
+
+/**
+ * \brief Forces all the fields to be redrawn by the next #lcd_dashboard_poll() without the rate limit, e.g. after #lcd_clear()
+ * \param state Field states
+ * \param count Number of fields
+ */
+void lcd_dashboard_invalidate(lcd_field_state_t state[], const uint8_t count);
+
+#endif /* SLS_AVR_LCD_DASHBOARD_H_ */
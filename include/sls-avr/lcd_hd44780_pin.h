@@ -42,6 +42,30 @@
 
 #if LCD_HD44780_PIN_MULTI_MODE
 
+#	ifndef LCD_HD44780_PIN_FLASH_INFO
+#		define LCD_HD44780_PIN_FLASH_INFO	0 /**< \brief Display descriptors are placed in flash as <tt>const __flash</tt> instead of SRAM. \details Multidisplay mode only. The descriptor is defined by #LCD_HD44780_PIN_INFO() and passed to #lcd_init(), only the flags of the #lcd_init_t structure are used then. */
+#	endif // LCD_HD44780_PIN_FLASH_INFO
+
+#	ifndef LCD_HD44780_PIN_BROADCAST
+#		define LCD_HD44780_PIN_BROADCAST	0 /**< \brief Enables the lcd_broadcast_xxx() functions, which write to all the displays of #lcd_bus_t at once. \details Multidisplay mode only. */
+#	endif // LCD_HD44780_PIN_BROADCAST
+
+#	ifndef LCD_HD44780_PIN_BUS_SIZE
+#		define LCD_HD44780_PIN_BUS_SIZE		4 /**< \brief Maximum number of displays in #lcd_bus_t. \details Multidisplay mode only, up to 8. */
+#	endif // LCD_HD44780_PIN_BUS_SIZE
+
+#	if (LCD_HD44780_PIN_BUS_SIZE < 1) || (LCD_HD44780_PIN_BUS_SIZE > 8)
+#		error "LCD_HD44780_PIN_BUS_SIZE should be in range 1-8!"
+#	endif
+
+/** \cond NO_DOC */
+#	if LCD_HD44780_PIN_FLASH_INFO
+#		define __LCD_INFO_SPACE				__flash
+#	else
+#		define __LCD_INFO_SPACE
+#	endif
+/** \endcond */
+
 typedef uint8_t lcd_addr_t;
 typedef struct {
 	uint8_t flags;
@@ -66,22 +90,35 @@ typedef struct {
 	port_t rw_port;
 	pin_bit_t rw_pin;
 
-	lcd_addr_t row_1_addr;
-	lcd_addr_t row_2_addr;
-	lcd_addr_t row_3_addr;
-	lcd_addr_t row_4_addr;
+#	if LCD_HD44780_PIN_FLASH_INFO
+	ddr_t rs_ddr; // For lcd_init(), the descriptor holds all the wiring
+	ddr_t e_ddr;
+	ddr_t rw_ddr;
+#	endif
+
+	lcd_addr_t row_addr[4]; // DDRAM address of each row, indexed by lcd_line_t
 } lcd_info_struct;
 
+#	if LCD_HD44780_PIN_FLASH_INFO
+typedef const __flash lcd_info_struct lcd_info_t;
+#	else
 typedef volatile lcd_info_struct lcd_info_t;
+#	endif
 
 #	define __LCD_MULTIMODE_ONLY_INFO_ARG(_n)			const lcd_info_t *const _ ## _n
 #	define __LCD_MULTIMODE_ONLY_INFO_ARG_WITH_COMMA(_n) __LCD_MULTIMODE_ONLY_INFO_ARG(_n),
+#	define __LCD_MULTIMODE_ONLY_VAR(_n)						(_ ## _n)
+#	define __LCD_MULTIMODE_ONLY_VAR_BY_REF(_n)				&__LCD_MULTIMODE_ONLY_VAR(_n)
+#	define __LCD_MULTIMODE_ONLY_VAR_WITH_COMMA(_n)			__LCD_MULTIMODE_ONLY_VAR(_n),
+#	define __LCD_MULTIMODE_ONLY_VAR_BY_REF_WITH_COMMA(_n)	&__LCD_MULTIMODE_ONLY_VAR_WITH_COMMA(_n)
+#	define __LCD_MULTIMODE_INFO_ROWS(_n)					((_ ## _n)->row_cout)
+#	define __LCD_MULTIMODE_INFO_COLS(_n)					((_ ## _n)->col_cout)
 
 #else
 #	define LCD_HD44780_PIN_MULTI_MODE 		0 /**< \brief Multidisplay display mode */
 
 #	ifndef LCD_HD44780_PIN_DISPLAY_TYPE
-#		define LCD_HD44780_PIN_DISPLAY_TYPE /**< \brief Display type. \details One of: #HD44780_DISPLAY_8X1, #HD44780_DISPLAY_16X1, #HD44780_DISPLAY_16X2, #HD44780_DISPLAY_20X2, #HD44780_DISPLAY_32X2, #HD44780_DISPLAY_40X2, #HD44780_DISPLAY_16X4, #HD44780_DISPLAY_20X4. */
+#		define LCD_HD44780_PIN_DISPLAY_TYPE /**< \brief Display type. \details One of: #HD44780_DISPLAY_8X1, #HD44780_DISPLAY_16X1, #HD44780_DISPLAY_16X2, #HD44780_DISPLAY_20X2, #HD44780_DISPLAY_32X2, #HD44780_DISPLAY_40X2, #HD44780_DISPLAY_16X4, #HD44780_DISPLAY_20X4, #HD44780_DISPLAY_40X4. */
 #		error "LCD_HD44780_PIN_DISPLAY_TYPE should be specified"
 #	endif
 
@@ -89,7 +126,7 @@ typedef volatile lcd_info_struct lcd_info_t;
 #		error "LCD_HD44780_PIN_DATA_PORT should be specified"
 #	endif
 
-#	if !LCD_HD44780_PIN_IDL_8BIT
+#	if !LCD_HD44780_PIN_IDL_8BIT && !LCD_HD44780_PIN_DUAL_NIBBLE
 #		ifndef LCD_HD44780_PIN_DATA_FIRST_PIN
 #			error "For 4-bit IDL the LCD_HD44780_PIN_DATA_FIRST_PIN should be specified!"
 #		endif
@@ -103,9 +140,20 @@ typedef volatile lcd_info_struct lcd_info_t;
 #		error "LCD_HD44780_PIN_E_PORT and LCD_HD44780_PIN_E_PIN should be specified!"
 #	endif
 
+#	if (LCD_HD44780_PIN_DISPLAY_TYPE == HD44780_DISPLAY_40X4) && ((!defined(LCD_HD44780_PIN_E2_PORT)) || (!defined(LCD_HD44780_PIN_E2_PIN)))
+#		error "For the 40x4 display LCD_HD44780_PIN_E2_PORT and LCD_HD44780_PIN_E2_PIN should be specified!"
+#	endif
+
 #	if defined(LCD_HD44780_PIN_RW_PORT) && defined(LCD_HD44780_PIN_RW_PIN)
 #		define LCD_HD44780_PIN_ALLOW_RW		1
 #	endif
+
+#	if LCD_HD44780_PIN_FLASH_INFO
+#		error "The flash descriptors are supported only in multidisplay mode!"
+#	endif
+#	if LCD_HD44780_PIN_BROADCAST
+#		error "The broadcast writes are supported only in multidisplay mode!"
+#	endif
 /** \cond NO_DOC */
 #	if LCD_HD44780_PIN_SINGLE_SOME_CODE
 #		define lcd_info_t										byte_t
@@ -114,11 +162,148 @@ typedef volatile lcd_info_struct lcd_info_t;
 #	endif // LCD_HD44780_PIN_SINGLE_SOME_CODE
 #	define __LCD_MULTIMODE_ONLY_INFO_ARG(_n)				void
 #	define __LCD_MULTIMODE_ONLY_INFO_ARG_WITH_COMMA(_n)
+#	define __LCD_MULTIMODE_ONLY_VAR(_n)
+#	define __LCD_MULTIMODE_ONLY_VAR_BY_REF(_n)
+#	define __LCD_MULTIMODE_ONLY_VAR_WITH_COMMA(_n)
+#	define __LCD_MULTIMODE_ONLY_VAR_BY_REF_WITH_COMMA(_n)
+#	define __LCD_MULTIMODE_INFO_ROWS(_n)					__HD44780_DISPLAY_ROWS(LCD_HD44780_PIN_DISPLAY_TYPE)
+#	define __LCD_MULTIMODE_INFO_COLS(_n)					__HD44780_DISPLAY_COLS(LCD_HD44780_PIN_DISPLAY_TYPE)
 /** \endcond */
 #endif // LCD_HD44780_PIN_MULTI_MODE
 
+#ifndef LCD_HD44780_PIN_SHADOW
+#	define LCD_HD44780_PIN_SHADOW 			0 /**< \brief Keeps a copy of the visible cells in SRAM, so that only changed cells are sent to the display. \details Single display mode only. Requires the cursor increment entry mode without shift, otherwise all cells are sent as usual. */
+#endif // LCD_HD44780_PIN_SHADOW
+
+#if LCD_HD44780_PIN_SHADOW && LCD_HD44780_PIN_MULTI_MODE
+#	error "The shadow buffer is supported only in single display mode!"
+#endif
+
+#ifndef LCD_HD44780_PIN_TRACK_ADDR
+#	define LCD_HD44780_PIN_TRACK_ADDR		0 /**< \brief Tracks the address counter in SRAM, so that the DDRAM address commands to the address already reached by the increment are not sent. \details Single display mode only. Requires the cursor increment entry mode without shift, otherwise all address commands are sent as usual. #LCD_HD44780_PIN_SHADOW always tracks the address. */
+#endif // LCD_HD44780_PIN_TRACK_ADDR
+
+#if LCD_HD44780_PIN_TRACK_ADDR && LCD_HD44780_PIN_MULTI_MODE
+#	error "The address tracking is supported only in single display mode!"
+#endif
+
+#ifndef LCD_HD44780_PIN_GLYPH_CACHE
+#	define LCD_HD44780_PIN_GLYPH_CACHE		0 /**< \brief Maps the glyphs stored in flash onto the 8 CGRAM slots, see #lcd_glyph(). \details Single display mode only. A glyph is uploaded only if it is not resident yet, replacing the least recently used unpinned slot. The address counter is tracked as with #LCD_HD44780_PIN_TRACK_ADDR, so the DDRAM address is restored after an upload. */
+#endif // LCD_HD44780_PIN_GLYPH_CACHE
+
+#if LCD_HD44780_PIN_GLYPH_CACHE && LCD_HD44780_PIN_MULTI_MODE
+#	error "The glyph cache is supported only in single display mode!"
+#endif
+
+#ifndef LCD_HD44780_PIN_UTF8
+#	define LCD_HD44780_PIN_UTF8			0 /**< \brief Decodes UTF-8 strings into the codes of the character generator ROM: #HD44780_ROM_A00, #HD44780_ROM_A02 or 0 to output the bytes as is. \details Used by #lcd_print(), #lcd_line(), #lcd_refresh_ml() and their _P variants, a sequence gives one symbol. The letters missing in the ROM are replaced by similar ones where possible. The others are output as #LCD_HD44780_PIN_UTF8_MISSING or, with #LCD_HD44780_PIN_GLYPH_CACHE, as the glyphs given by #lcd_utf8_glyphs(). */
+#endif // LCD_HD44780_PIN_UTF8
+
+#ifndef LCD_HD44780_PIN_UTF8_MISSING
+#	define LCD_HD44780_PIN_UTF8_MISSING	'?' /**< \brief The symbol for the characters missing in the ROM, see #LCD_HD44780_PIN_UTF8. */
+#endif // LCD_HD44780_PIN_UTF8_MISSING
+
+#if LCD_HD44780_PIN_UTF8 && (LCD_HD44780_PIN_UTF8 != HD44780_ROM_A00) && (LCD_HD44780_PIN_UTF8 != HD44780_ROM_A02)
+#	error "LCD_HD44780_PIN_UTF8 should be HD44780_ROM_A00, HD44780_ROM_A02 or 0!"
+#endif
+
+#ifndef LCD_HD44780_PIN_ASYNC
+#	define LCD_HD44780_PIN_ASYNC 			0 /**< \brief Queues output instead of waiting for the controller. \details Single display mode only. The queue is sent to the display by #lcd_async_proc(), which should be called from a timer interrupt every #LCD_HD44780_PIN_ASYNC_TICK_US. Reading from the controller is not used to wait, even if it is enabled. */
+#endif // LCD_HD44780_PIN_ASYNC
+
+#ifndef LCD_HD44780_PIN_ASYNC_TICK_US
+#	define LCD_HD44780_PIN_ASYNC_TICK_US	HD44780_EXEC_TIME_US /**< \brief The period of #lcd_async_proc() calls, us. \details One queued byte is sent per call at most, so it should not be less than #HD44780_EXEC_TIME_US for best throughput. */
+#endif // LCD_HD44780_PIN_ASYNC_TICK_US
+
+#ifndef LCD_HD44780_PIN_ASYNC_QUEUE_SIZE
+#	define LCD_HD44780_PIN_ASYNC_QUEUE_SIZE	32 /**< \brief Output queue size in bytes, power of 2 in range 2-128. One entry less is usable. \details Each entry occupies 2 bytes of SRAM. */
+#endif // LCD_HD44780_PIN_ASYNC_QUEUE_SIZE
+
+#if LCD_HD44780_PIN_ASYNC && LCD_HD44780_PIN_MULTI_MODE
+#	error "The asynchronous output is supported only in single display mode!"
+#endif
+
+#ifndef LCD_HD44780_PIN_DEFERRED_WAIT
+#	define LCD_HD44780_PIN_DEFERRED_WAIT	0 /**< \brief Waits for the controller before the next operation instead of after each write. \details Single display mode only. The execution time overlaps with the code running between two writes. With RW the busy flag is polled before the next operation, otherwise #LCD_HD44780_PIN_TIMER() should be defined. Without RW a write after an idle period longer than the timer period may wait up to one execution time more. */
+#endif // LCD_HD44780_PIN_DEFERRED_WAIT
+
+#if LCD_HD44780_PIN_DEFERRED_WAIT
+#	if LCD_HD44780_PIN_MULTI_MODE
+#		error "The deferred wait is supported only in single display mode!"
+#	endif
+#	if LCD_HD44780_PIN_ASYNC
+#		error "LCD_HD44780_PIN_DEFERRED_WAIT and LCD_HD44780_PIN_ASYNC can not be used together!"
+#	endif
+#	if (!LCD_HD44780_PIN_ALLOW_RW) && ((!defined(LCD_HD44780_PIN_TIMER)) || (!defined(LCD_HD44780_PIN_TIMER_HZ)))
+#		error "LCD_HD44780_PIN_TIMER() and LCD_HD44780_PIN_TIMER_HZ should be specified for the deferred wait without RW!"
+#	endif
+#endif // LCD_HD44780_PIN_DEFERRED_WAIT
+
+#ifndef LCD_HD44780_PIN_CALIBRATE
+#	define LCD_HD44780_PIN_CALIBRATE		0 /**< \brief Measures the execution times of the connected controller during #lcd_init() and waits for them afterwards instead of polling the busy flag. \details Single display mode only. Requires RW, #LCD_HD44780_PIN_TIMER() and #LCD_HD44780_PIN_TIMER_HZ. The measured times never exceed #HD44780_EXEC_TIME_US and #HD44780_LONG_EXEC_TIME_US by more than a timer tick. Data writes wait #HD44780_ADD_US longer than the commands. The timer tick should not be longer than #HD44780_CMD_EXEC_TIME_US. */
+#endif // LCD_HD44780_PIN_CALIBRATE
+
+#ifndef LCD_HD44780_PIN_CALIBRATE_MARGIN
+#	define LCD_HD44780_PIN_CALIBRATE_MARGIN	25 /**< \brief Margin added to the measured execution times, %. \details Covers the controller clock drift with temperature and supply voltage. */
+#endif // LCD_HD44780_PIN_CALIBRATE_MARGIN
+
+#if LCD_HD44780_PIN_CALIBRATE
+#	if LCD_HD44780_PIN_MULTI_MODE
+#		error "The timing calibration is supported only in single display mode!"
+#	endif
+#	if LCD_HD44780_PIN_ASYNC
+#		error "LCD_HD44780_PIN_CALIBRATE and LCD_HD44780_PIN_ASYNC can not be used together!"
+#	endif
+#	if !LCD_HD44780_PIN_ALLOW_RW
+#		error "The timing calibration requires LCD_HD44780_PIN_RW_PORT and LCD_HD44780_PIN_RW_PIN!"
+#	endif
+#	if (!defined(LCD_HD44780_PIN_TIMER)) || (!defined(LCD_HD44780_PIN_TIMER_HZ))
+#		error "LCD_HD44780_PIN_TIMER() and LCD_HD44780_PIN_TIMER_HZ should be specified for the timing calibration!"
+#	elif (LCD_HD44780_PIN_TIMER_HZ) * HD44780_CMD_EXEC_TIME_US < 1000000UL
+#		error "The LCD_HD44780_PIN_TIMER_HZ tick should not be longer than HD44780_CMD_EXEC_TIME_US for the timing calibration!"
+#	endif
+#endif // LCD_HD44780_PIN_CALIBRATE
+
+#ifndef LCD_HD44780_PIN_DUAL_NIBBLE
+#	define LCD_HD44780_PIN_DUAL_NIBBLE		0 /**< \brief Two 4-bit displays of the same type share the data port, RS and E: the first one is connected to the low nibble of the port, the second one to the high nibble. \details Single display mode only. The commands and #lcd_byte() go to both displays, #lcd_pair_byte() and #lcd_pair_line() send different symbols to them by the same E pulses. LCD_HD44780_PIN_DATA_FIRST_PIN is not used. */
+#endif // LCD_HD44780_PIN_DUAL_NIBBLE
+
+#if LCD_HD44780_PIN_DUAL_NIBBLE
+#	if LCD_HD44780_PIN_MULTI_MODE
+#		error "The dual nibble mode is supported only in single display mode!"
+#	endif
+#	if LCD_HD44780_PIN_IDL_8BIT
+#		error "The dual nibble mode requires 4-bit IDL!"
+#	endif
+#	if LCD_HD44780_PIN_ALLOW_RW
+#		error "The dual nibble mode can not read the controllers, LCD_HD44780_PIN_RW_PORT and LCD_HD44780_PIN_RW_PIN should not be specified!"
+#	endif
+#	if LCD_HD44780_PIN_SHADOW || LCD_HD44780_PIN_ASYNC || (LCD_HD44780_PIN_DISPLAY_TYPE == HD44780_DISPLAY_40X4)
+#		error "The dual nibble mode can not be used with LCD_HD44780_PIN_SHADOW, LCD_HD44780_PIN_ASYNC or the 40x4 display!"
+#	endif
+#endif // LCD_HD44780_PIN_DUAL_NIBBLE
+
 #if __DOXYGEN__
-/** \brief Information to distinguish a specific display from several connected ones.\details This parameter is set during LCD initialization and should not be changed manually later. */
+#	define LCD_HD44780_PIN_E2_PORT			B /**< \brief E(enable) port of the second controller of the 40x4 display, rows 3 and 4. \details Single display mode only. With RW the busy flags of the two controllers are polled independently, so one controller receives the data while the other one executes. */
+#	define LCD_HD44780_PIN_E2_PIN			PB3 /**< \brief E(enable) pin of the second controller of the 40x4 display. */
+#endif // __DOXYGEN__
+
+#if !LCD_HD44780_PIN_MULTI_MODE && (LCD_HD44780_PIN_DISPLAY_TYPE == HD44780_DISPLAY_40X4)
+#	if LCD_HD44780_PIN_SHADOW || LCD_HD44780_PIN_TRACK_ADDR || LCD_HD44780_PIN_GLYPH_CACHE || LCD_HD44780_PIN_ASYNC || LCD_HD44780_PIN_CALIBRATE
+#		error "The 40x4 display can not be used with LCD_HD44780_PIN_SHADOW, LCD_HD44780_PIN_TRACK_ADDR, LCD_HD44780_PIN_GLYPH_CACHE, LCD_HD44780_PIN_ASYNC or LCD_HD44780_PIN_CALIBRATE!"
+#	endif
+#	if LCD_HD44780_PIN_DEFERRED_WAIT && !LCD_HD44780_PIN_ALLOW_RW
+#		error "For the 40x4 display the deferred wait requires LCD_HD44780_PIN_RW_PORT and LCD_HD44780_PIN_RW_PIN!"
+#	endif
+#endif
+
+#if __DOXYGEN__
+#	define LCD_HD44780_PIN_TIMER()			TCNT1 /**< \brief Free running 16 bit timer counter, which should wrap at 0xFFFF, for example, TCNT1. \details Used by the deferred wait without RW and by the timing calibration. The counter is never reset by the driver. */
+#	define LCD_HD44780_PIN_TIMER_HZ		(F_CPU / 8) /**< \brief Frequency of #LCD_HD44780_PIN_TIMER() counting, Hz. */
+#endif // __DOXYGEN__
+
+#if __DOXYGEN__
+/** \brief Information to distinguish a specific display from several connected ones.\details This parameter is set during LCD initialization and should not be changed manually later. With #LCD_HD44780_PIN_FLASH_INFO it is a <tt>const __flash</tt> descriptor. */
 typedef volatile lcd_info_struct lcd_info_t;
 #endif // __DOXYGEN__
 
@@ -126,7 +311,7 @@ typedef volatile lcd_info_struct lcd_info_t;
 /** \brief Initialization information. */
 typedef struct {
 	uint8_t flags; /**< \brief Config flags */
-	#if LCD_HD44780_PIN_MULTI_MODE || __DOXYGEN__
+	#if (LCD_HD44780_PIN_MULTI_MODE && !LCD_HD44780_PIN_FLASH_INFO) || __DOXYGEN__
 	lcd_display_t display_type; /**< \brief Display type, see #lcd_display_t */
 
 	ddr_t data_ddr; /**< \brief Data DDRx register \details Multidisplay or some code modes only. See #LCD_HD44780_PIN_MULTI_MODE , #LCD_HD44780_PIN_SINGLE_SOME_CODE */
@@ -200,6 +385,7 @@ typedef struct {
 /** \endcond */
 
 #if LCD_HD44780_PIN_MULTI_MODE || __DOXYGEN__
+#	if !LCD_HD44780_PIN_FLASH_INFO || __DOXYGEN__
 /**
  * \section multi lcd_info_t lcd_init(const lcd_init_t *const config)
  * \brief Initializes the display
@@ -210,6 +396,78 @@ typedef struct {
  */
 lcd_info_t lcd_init(const lcd_init_t *const config);
 
+/**
+ * \section multi lcd_info_struct lcd_setup(const lcd_init_t *const config)
+ * \brief Sets up the pins of the display without the initialization sequence, see #lcd_broadcast_init()
+ *
+ *  Multidisplay mode only. See #LCD_HD44780_PIN_MULTI_MODE
+ * \param config #lcd_init_t structure
+ * \return #lcd_info_t structure.
+ */
+lcd_info_struct lcd_setup(const lcd_init_t *const config);
+#	endif // LCD_HD44780_PIN_FLASH_INFO
+
+#	if LCD_HD44780_PIN_FLASH_INFO || __DOXYGEN__
+/**
+ * \section flash void lcd_init(const lcd_info_t *const info, const lcd_init_t *const config)
+ * \brief Initializes the display by a flash descriptor
+ *
+ *  Multidisplay mode with #LCD_HD44780_PIN_FLASH_INFO only.
+ * \param info #lcd_info_t reference, defined by #LCD_HD44780_PIN_INFO().
+ * \param config #lcd_init_t structure, only the flags are used.
+ * \code
+ * const __flash lcd_info_struct lcd_main = LCD_HD44780_PIN_INFO(HD44780_DISPLAY_20X4, HD44780_INIT_IDL_4BIT | HD44780_INIT_READ_ON, D, 4, B, PB0, B, PB1, B, PB2);
+ * ...
+ * lcd_init(&lcd_main, &config);
+ * \endcode
+ */
+void lcd_init(const lcd_info_t *const info, const lcd_init_t *const config);
+
+/**
+ * \section flash void lcd_setup(const lcd_info_t *const info)
+ * \brief Sets up the pins of the display by a flash descriptor without the initialization sequence, see #lcd_broadcast_init()
+ *
+ *  Multidisplay mode with #LCD_HD44780_PIN_FLASH_INFO only.
+ * \param info #lcd_info_t reference, defined by #LCD_HD44780_PIN_INFO().
+ */
+void lcd_setup(const lcd_info_t *const info);
+#	endif // LCD_HD44780_PIN_FLASH_INFO
+
+/**
+ * \brief Constant descriptor initializer.
+ *
+ * Multidisplay mode only. See #LCD_HD44780_PIN_MULTI_MODE
+ * \details The arguments are the same as the entry of #LCD_HD44780_PIN_INSTANCES() without the name, the ports are given by letter. Without reading the RW port and pin are not used, but should be valid. #HD44780_DISPLAY_40X4 is not supported, its second E line is handled only in single display mode.
+ */
+#	define LCD_HD44780_PIN_INFO(_type, _flags, _data, _shift, _rs, _rs_pin, _e, _e_pin, _rw, _rw_pin) { \
+	.flags = (__LCD_INFO_IS_8BIT(_flags) ? _HD44780_CONF_IDL_8BIT : _HD44780_CONF_IDL_4BIT) | (__LCD_INFO_IS_READ(_flags) ? _HD44780_CONF_READ_ON : _HD44780_CONF_READ_OFF), \
+	.row_cout = __HD44780_DISPLAY_ROWS(_type), \
+	.col_cout = __HD44780_DISPLAY_COLS(_type), \
+	.data_ddr = &MAKE_DDR_NAME(_data), \
+	.data_port = &MAKE_PORT_NAME(_data), \
+	.data_pin = &MAKE_PIN_NAME(_data), \
+	.data_shift = __LCD_INFO_IS_8BIT(_flags) ? 0 : (_shift), \
+	.port_mask = __LCD_INFO_IS_8BIT(_flags) ? 0xFF : (_HD44780_HALF_DATA_MASK << (_shift)), \
+	.rs_port = &MAKE_PORT_NAME(_rs), \
+	.rs_pin = (_rs_pin), \
+	.e_port = &MAKE_PORT_NAME(_e), \
+	.e_pin = (_e_pin), \
+	.rw_port = &MAKE_PORT_NAME(_rw), \
+	.rw_pin = (_rw_pin), \
+	__LCD_INFO_DDRS(_rs, _e, _rw) \
+	.row_addr = { HD44780_ROW_1_DDRAM_ADR, HD44780_ROW_2_DDRAM_ADR, __HD44780_DISPLAY_ROW_3_ADR(_type), __HD44780_DISPLAY_ROW_4_ADR(_type) }, \
+}
+
+/** \cond NO_DOC */
+#	define __LCD_INFO_IS_8BIT(_flags)		flag_is_set((_flags), __HD44780_INIT_IDL_BIT)
+#	define __LCD_INFO_IS_READ(_flags)		flag_is_set((_flags), __HD44780_INIT_READ_BIT)
+#	if LCD_HD44780_PIN_FLASH_INFO
+#		define __LCD_INFO_DDRS(_rs, _e, _rw)	.rs_ddr = &MAKE_DDR_NAME(_rs), .e_ddr = &MAKE_DDR_NAME(_e), .rw_ddr = &MAKE_DDR_NAME(_rw),
+#	else
+#		define __LCD_INFO_DDRS(_rs, _e, _rw)
+#	endif
+/** \endcond */
+
 /**
  * \brief Clears the display
  *
@@ -330,6 +588,116 @@ void lcd_print(const lcd_info_t *const info, const char str[]);
  */
 void lcd_refresh_ml(const lcd_info_t *const info, const char str[]);
 
+/**
+ * \brief Outputs a buffer of symbols from the current address
+ *
+ * Multidisplay or some code modes only. See #LCD_HD44780_PIN_MULTI_MODE , #LCD_HD44780_PIN_SINGLE_SOME_CODE
+ * \details With reading enabled the symbols are sent back to back, only the busy flag is polled between them. No line overflow control, zero bytes are output as the custom symbol 0.
+ * \param info #lcd_info_t reference.
+ * \param buf Symbol codes
+ * \param len Number of symbols
+ */
+void lcd_write_block(const lcd_info_t *const info, const byte_t buf[], const uint8_t len);
+
+/**
+ * \brief Outputs a buffer of symbols from the display position, see #lcd_write_block()
+ *
+ * Multidisplay or some code modes only. See #LCD_HD44780_PIN_MULTI_MODE , #LCD_HD44780_PIN_SINGLE_SOME_CODE
+ * \param info #lcd_info_t reference.
+ * \param line Display row
+ * \param pos Display column
+ * \param buf Symbol codes
+ * \param len Number of symbols
+ */
+void lcd_write_at(const lcd_info_t *const info, const lcd_line_t line, const uint8_t pos, const byte_t buf[], const uint8_t len);
+
+/**
+ * \brief Outputs a program memory string on entry line, see #lcd_line()
+ *
+ * Multidisplay or some code modes only. See #LCD_HD44780_PIN_MULTI_MODE , #LCD_HD44780_PIN_SINGLE_SOME_CODE
+ * \param info #lcd_info_t reference.
+ * \param str A string in program memory, e.g. <tt>PSTR("Menu")</tt>
+ * \param line Display row
+ * \param start_pos Starts with the display column
+ */
+void lcd_line_P(const lcd_info_t *const info, const char str[], const lcd_line_t line, const uint8_t start_pos);
+
+/**
+ * \brief Outputs a program memory string to buffer, see #lcd_print()
+ *
+ * Multidisplay or some code modes only. See #LCD_HD44780_PIN_MULTI_MODE , #LCD_HD44780_PIN_SINGLE_SOME_CODE
+ * \param info #lcd_info_t reference.
+ * \param str A string in program memory
+ */
+void lcd_print_P(const lcd_info_t *const info, const char str[]);
+
+/**
+ * \brief Outputs a program memory string on all lines, see #lcd_refresh_ml()
+ *
+ * Multidisplay or some code modes only. See #LCD_HD44780_PIN_MULTI_MODE , #LCD_HD44780_PIN_SINGLE_SOME_CODE
+ * \param info #lcd_info_t reference.
+ * \param str A string in program memory
+ */
+void lcd_refresh_ml_P(const lcd_info_t *const info, const char str[]);
+
+/**
+ * \brief Outputs a buffer of symbols placed in flash, see #lcd_write_block()
+ *
+ * Multidisplay or some code modes only. See #LCD_HD44780_PIN_MULTI_MODE , #LCD_HD44780_PIN_SINGLE_SOME_CODE
+ * \param info #lcd_info_t reference.
+ * \param buf Symbol codes
+ * \param len Number of symbols
+ */
+void lcd_write_block_P(const lcd_info_t *const info, const __flash byte_t buf[], const uint8_t len);
+
+/**
+ * \brief Outputs an unsigned number from the current address
+ *
+ * Multidisplay or some code modes only. See #LCD_HD44780_PIN_MULTI_MODE , #LCD_HD44780_PIN_SINGLE_SOME_CODE
+ * \details The digits are output one by one without a string buffer and printf(). The number is not truncated if it is wider than the field.
+ * \param info #lcd_info_t reference.
+ * \param value A number
+ * \param width Minimum field width, the number is right-aligned
+ * \param pad Padding symbol, e.g. <tt>' '</tt> or <tt>'0'</tt>
+ */
+void lcd_put_u16(const lcd_info_t *const info, const uint16_t value, const uint8_t width, const char pad);
+
+/**
+ * \brief Outputs an unsigned number from the current address, see #lcd_put_u16()
+ *
+ * Multidisplay or some code modes only. See #LCD_HD44780_PIN_MULTI_MODE , #LCD_HD44780_PIN_SINGLE_SOME_CODE
+ * \param info #lcd_info_t reference.
+ * \param value A number
+ * \param width Minimum field width, the number is right-aligned
+ * \param pad Padding symbol
+ */
+void lcd_put_u32(const lcd_info_t *const info, const uint32_t value, const uint8_t width, const char pad);
+
+/**
+ * \brief Outputs a signed number from the current address, see #lcd_put_u16()
+ *
+ * Multidisplay or some code modes only. See #LCD_HD44780_PIN_MULTI_MODE , #LCD_HD44780_PIN_SINGLE_SOME_CODE
+ * \details With the <tt>'0'</tt> padding the sign goes before the zeros.
+ * \param info #lcd_info_t reference.
+ * \param value A number
+ * \param width Minimum field width including the sign
+ * \param pad Padding symbol
+ */
+void lcd_put_i32(const lcd_info_t *const info, const int32_t value, const uint8_t width, const char pad);
+
+/**
+ * \brief Outputs a fixed-point number from the current address, see #lcd_put_i32()
+ *
+ * Multidisplay or some code modes only. See #LCD_HD44780_PIN_MULTI_MODE , #LCD_HD44780_PIN_SINGLE_SOME_CODE
+ * \details E.g. the value 2150 with two fractional digits is output as <tt>21.50</tt>, the value -5 as <tt>-0.05</tt>.
+ * \param info #lcd_info_t reference.
+ * \param value The number multiplied by 10<sup>frac_digits</sup>
+ * \param frac_digits Number of the fractional digits 0-9
+ * \param width Minimum field width including the sign and the point
+ * \param pad Padding symbol
+ */
+void lcd_put_fixed(const lcd_info_t *const info, const int32_t value, const uint8_t frac_digits, const uint8_t width, const char pad);
+
 /**
  * \brief Creates a custom symbol.
  *
@@ -341,6 +709,18 @@ void lcd_refresh_ml(const lcd_info_t *const info, const char str[]);
  */
 void lcd_custom_char(const lcd_info_t *const info, const byte_t char_pos, const byte_t custom_char[8]);
 
+/**
+ * \brief Loads consecutive custom symbols from flash after a single CGRAM address command.
+ *
+ * Multidisplay or some code modes only. See #LCD_HD44780_PIN_MULTI_MODE , #LCD_HD44780_PIN_SINGLE_SOME_CODE
+ * \details The DDRAM address read back before the upload is restored afterwards. Without reading it is not restored, see #lcd_custom_char().
+ * \param info #lcd_info_t reference.
+ * \param first_slot The slot of the first symbol 0-7.
+ * \param glyphs Symbols of 8 bytes each in flash.
+ * \param count Number of the symbols, the symbols beyond the slot 7 are not loaded.
+ */
+void lcd_load_glyph_set(const lcd_info_t *const info, const byte_t first_slot, const __flash byte_t glyphs[][8], const uint8_t count);
+
 /**
  * \brief Waits until display is buisy and returns address counter contents.
  *
@@ -358,6 +738,120 @@ byte_t lcd_read_busy_and_addr(const lcd_info_t *const info);
  * \return Readed byte
  */
 byte_t lcd_read_data(const lcd_info_t *const info);
+
+/**
+ * \brief Displays on the same data, RS and RW lines, which differ only by E.
+ *
+ * Multidisplay mode only. See #LCD_HD44780_PIN_MULTI_MODE
+ */
+typedef struct {
+	const lcd_info_t *const *displays; /**< \brief Displays, up to #LCD_HD44780_PIN_BUS_SIZE. The data, RS and RW lines are taken from the first one. */
+	uint8_t count; /**< \brief Number of the displays */
+} lcd_bus_t;
+
+/**
+ * \brief Refreshes the contents of several displays on a shared bus as #lcd_refresh_ml() does
+ *
+ *  Multidisplay mode only. See #LCD_HD44780_PIN_MULTI_MODE
+ * \details The next byte is sent to any display which is not busy, so the displays execute at the same time.
+ * The busy flags of all the displays are polled at once, with a single switch of the bus direction.
+ * A display initialized with #HD44780_INIT_READ_OFF is waited by a delay after each byte.
+ * \param bus #lcd_bus_t reference.
+ * \param str Text for each display, NULL to skip the display.
+ */
+void lcd_bus_refresh_ml(const lcd_bus_t *const bus, const char *const str[]);
+
+#	if LCD_HD44780_PIN_BROADCAST || __DOXYGEN__
+/**
+ * \brief Initializes all the displays of the bus by one initialization sequence
+ *
+ *  Multidisplay mode with #LCD_HD44780_PIN_BROADCAST only.
+ * \details All the E lines are raised at once, so the displays should have the same interface data length and number of rows. The pins should be set up by lcd_setup() before.
+ * The busy flags are not read while broadcasting, the constant delays are used.
+ * \param bus #lcd_bus_t reference.
+ * \param config #lcd_init_t structure, only the flags are used.
+ */
+void lcd_broadcast_init(const lcd_bus_t *const bus, const lcd_init_t *const config);
+
+/**
+ * \brief Writes the same line to all the displays of the bus, see #lcd_line()
+ *
+ *  Multidisplay mode with #LCD_HD44780_PIN_BROADCAST only.
+ * \details The geometry of the first display is used.
+ * \param bus #lcd_bus_t reference.
+ * \param str Text
+ * \param line Line number. See #lcd_line_t
+ * \param start_pos First position
+ */
+void lcd_broadcast_line(const lcd_bus_t *const bus, const char str[], const lcd_line_t line, const uint8_t start_pos);
+
+/**
+ * \brief Loads the same custom character to all the displays of the bus, see #lcd_custom_char()
+ *
+ *  Multidisplay mode with #LCD_HD44780_PIN_BROADCAST only.
+ * \param bus #lcd_bus_t reference.
+ * \param char_pos Position of the character in CGRAM.
+ * \param custom_char Array of 8 bytes.
+ */
+void lcd_broadcast_custom_char(const lcd_bus_t *const bus, const byte_t char_pos, const byte_t custom_char[8]);
+#	endif // LCD_HD44780_PIN_BROADCAST
+
+#	if __DOXYGEN__
+/**
+ * \brief Compile-time list of the displays for multidisplay mode.
+ *
+ * Multidisplay mode only. See #LCD_HD44780_PIN_MULTI_MODE
+ * \details Each entry is <tt>_(name, type, flags, data_port, data_shift, rs_port, rs_pin, e_port, e_pin, rw_port, rw_pin)</tt>, the ports are given by letter as in single display mode.
+ * \a type is one of HD44780_DISPLAY_xxx, \a flags are #HD44780_INIT_IDL_4BIT or #HD44780_INIT_IDL_8BIT and #HD44780_INIT_READ_OFF or #HD44780_INIT_READ_ON. Without reading the RW port and pin are not used, but should be valid.
+ * For each entry the constant descriptor \c lcd_<name>_info and the functions \c lcd_<name>_setup(), \c lcd_<name>_init(config), \c lcd_<name>_clear(), \c lcd_<name>_byte(ch) and so on are generated, they take the same arguments as in single display mode.
+ * Only the flags of the #lcd_init_t structure are used by \c lcd_<name>_init(). The generated functions are compiled with the descriptor fields as constants, so they are as fast as single display mode.
+ * The descriptor can also be passed to the common functions, e.g. <tt>lcd_byte(&lcd_main_info, ch)</tt>.
+ * \code
+ * #define LCD_HD44780_PIN_INSTANCES(_) \
+ *	_(main, HD44780_DISPLAY_20X4, HD44780_INIT_IDL_4BIT | HD44780_INIT_READ_ON, D, 4, B, PB0, B, PB1, B, PB2) \
+ *	_(aux, HD44780_DISPLAY_16X2, HD44780_INIT_IDL_8BIT | HD44780_INIT_READ_OFF, C, 0, B, PB3, B, PB4, B, PB4)
+ * \endcode
+ */
+#		define LCD_HD44780_PIN_INSTANCES(_)
+#	endif // __DOXYGEN__
+
+#	ifdef LCD_HD44780_PIN_INSTANCES
+/** \cond NO_DOC */
+#		define __LCD_INSTANCE_DECLARE(_n, ...) \
+	extern const __LCD_INFO_SPACE lcd_info_struct lcd_ ## _n ## _info; \
+	void lcd_ ## _n ## _setup(void); \
+	void lcd_ ## _n ## _init(const lcd_init_t *const config); \
+	void lcd_ ## _n ## _clear(void); \
+	void lcd_ ## _n ## _home(const uint8_t flags); \
+	void lcd_ ## _n ## _entry_mode(const uint8_t flags); \
+	void lcd_ ## _n ## _display_ctrl(const uint8_t flags); \
+	void lcd_ ## _n ## _cursor(const uint8_t flags); \
+	void lcd_ ## _n ## _func_set(const uint8_t flags); \
+	void lcd_ ## _n ## _cgr_adr(const uint8_t flags); \
+	void lcd_ ## _n ## _ddr_adr(const uint8_t flags); \
+	void lcd_ ## _n ## _set_pos(const lcd_line_t line, const uint8_t pos); \
+	void lcd_ ## _n ## _byte(const byte_t ch); \
+	void lcd_ ## _n ## _line(const char str[], const lcd_line_t line, const uint8_t start_pos); \
+	void lcd_ ## _n ## _print(const char str[]); \
+	void lcd_ ## _n ## _refresh_ml(const char str[]); \
+	void lcd_ ## _n ## _write_block(const byte_t buf[], const uint8_t len); \
+	void lcd_ ## _n ## _write_at(const lcd_line_t line, const uint8_t pos, const byte_t buf[], const uint8_t len); \
+	void lcd_ ## _n ## _line_P(const char str[], const lcd_line_t line, const uint8_t start_pos); \
+	void lcd_ ## _n ## _print_P(const char str[]); \
+	void lcd_ ## _n ## _refresh_ml_P(const char str[]); \
+	void lcd_ ## _n ## _write_block_P(const __flash byte_t buf[], const uint8_t len); \
+	void lcd_ ## _n ## _put_u16(const uint16_t value, const uint8_t width, const char pad); \
+	void lcd_ ## _n ## _put_u32(const uint32_t value, const uint8_t width, const char pad); \
+	void lcd_ ## _n ## _put_i32(const int32_t value, const uint8_t width, const char pad); \
+	void lcd_ ## _n ## _put_fixed(const int32_t value, const uint8_t frac_digits, const uint8_t width, const char pad); \
+	void lcd_ ## _n ## _custom_char(const byte_t char_pos, const byte_t custom_char[8]); \
+	void lcd_ ## _n ## _load_glyph_set(const byte_t first_slot, const __flash byte_t glyphs[][8], const uint8_t count); \
+	byte_t lcd_ ## _n ## _read_busy_and_addr(void); \
+	byte_t lcd_ ## _n ## _read_data(void);
+
+LCD_HD44780_PIN_INSTANCES(__LCD_INSTANCE_DECLARE)
+/** \endcond */
+#	endif // LCD_HD44780_PIN_INSTANCES
 #endif // LCD_HD44780_PIN_MULTI_MODE
 
 #if !LCD_HD44780_PIN_MULTI_MODE
@@ -387,7 +881,18 @@ lcd_info_t lcd_init(const lcd_init_t *const config);
 		void _sc_lcd_line(const char str[], const lcd_line_t line, const uint8_t start_pos);
 		void _sc_lcd_print(const char str[]);
 		void _sc_lcd_refresh_ml(const char str[]);
+		void _sc_lcd_write_block(const byte_t buf[], const uint8_t len);
+		void _sc_lcd_write_at(const lcd_line_t line, const uint8_t pos, const byte_t buf[], const uint8_t len);
+		void _sc_lcd_line_P(const char str[], const lcd_line_t line, const uint8_t start_pos);
+		void _sc_lcd_print_P(const char str[]);
+		void _sc_lcd_refresh_ml_P(const char str[]);
+		void _sc_lcd_write_block_P(const __flash byte_t buf[], const uint8_t len);
+		void _sc_lcd_put_u16(const uint16_t value, const uint8_t width, const char pad);
+		void _sc_lcd_put_u32(const uint32_t value, const uint8_t width, const char pad);
+		void _sc_lcd_put_i32(const int32_t value, const uint8_t width, const char pad);
+		void _sc_lcd_put_fixed(const int32_t value, const uint8_t frac_digits, const uint8_t width, const char pad);
 		void _sc_lcd_custom_char(const byte_t char_pos, const byte_t custom_char[8]);
+		void _sc_lcd_load_glyph_set(const byte_t first_slot, const __flash byte_t glyphs[][8], const uint8_t count);
 		byte_t _sc_lcd_read_busy_and_addr();
 		byte_t _sc_lcd_read_data();
 #		define lcd_clear(_i)				_sc_lcd_clear()
@@ -403,7 +908,18 @@ lcd_info_t lcd_init(const lcd_init_t *const config);
 #		define lcd_line(_i, str, line, sp)	_sc_lcd_line((str), (line), (sp))
 #		define lcd_print(_i, str)			_sc_lcd_print((str))
 #		define lcd_refresh_ml(_i, str)		_sc_lcd_refresh_ml((str))
+#		define lcd_write_block(_i, b, n)	_sc_lcd_write_block((b), (n))
+#		define lcd_write_at(_i, l, p, b, n)	_sc_lcd_write_at((l), (p), (b), (n))
+#		define lcd_line_P(_i, str, line, sp)	_sc_lcd_line_P((str), (line), (sp))
+#		define lcd_print_P(_i, str)			_sc_lcd_print_P((str))
+#		define lcd_refresh_ml_P(_i, str)	_sc_lcd_refresh_ml_P((str))
+#		define lcd_write_block_P(_i, b, n)	_sc_lcd_write_block_P((b), (n))
+#		define lcd_put_u16(_i, v, w, p)		_sc_lcd_put_u16((v), (w), (p))
+#		define lcd_put_u32(_i, v, w, p)		_sc_lcd_put_u32((v), (w), (p))
+#		define lcd_put_i32(_i, v, w, p)		_sc_lcd_put_i32((v), (w), (p))
+#		define lcd_put_fixed(_i, v, f, w, p)	_sc_lcd_put_fixed((v), (f), (w), (p))
 #		define lcd_custom_char(_i, pos, s)	_sc_lcd_custom_char((pos), (s))
+#		define lcd_load_glyph_set(_i, f, g, n)	_sc_lcd_load_glyph_set((f), (g), (n))
 #		define lcd_read_busy_and_addr(_i)	_sc_lcd_read_busy_and_addr()
 #		define lcd_read_data(_i)			_sc_lcd_read_data()
 #	else
@@ -488,6 +1004,185 @@ void lcd_print(const char str[]);
  */
 void lcd_refresh_ml(const char str[]);
 
+/**
+ * \brief Outputs a buffer of symbols from the current address
+ * \details With RW the symbols are sent back to back, only the busy flag is polled between them. No line overflow control, zero bytes are output as the custom symbol 0.
+ * \param buf Symbol codes
+ * \param len Number of symbols
+ */
+void lcd_write_block(const byte_t buf[], const uint8_t len);
+
+/**
+ * \brief Outputs a buffer of symbols from the display position, see #lcd_write_block()
+ * \param line Display row
+ * \param pos Display column
+ * \param buf Symbol codes
+ * \param len Number of symbols
+ */
+void lcd_write_at(const lcd_line_t line, const uint8_t pos, const byte_t buf[], const uint8_t len);
+
+/**
+ * \brief Outputs a program memory string on entry line, see #lcd_line()
+ * \param str A string in program memory, e.g. <tt>PSTR("Menu")</tt>
+ * \param line Display row
+ * \param start_pos Starts with the display column
+ */
+void lcd_line_P(const char str[], const lcd_line_t line, const uint8_t start_pos);
+
+/**
+ * \brief Outputs a program memory string to buffer, see #lcd_print()
+ * \param str A string in program memory
+ */
+void lcd_print_P(const char str[]);
+
+/**
+ * \brief Outputs a program memory string on all lines, see #lcd_refresh_ml()
+ * \param str A string in program memory
+ */
+void lcd_refresh_ml_P(const char str[]);
+
+/**
+ * \brief Outputs a buffer of symbols placed in flash, see #lcd_write_block()
+ * \param buf Symbol codes
+ * \param len Number of symbols
+ */
+void lcd_write_block_P(const __flash byte_t buf[], const uint8_t len);
+
+/**
+ * \brief Outputs an unsigned number from the current address
+ * \details The digits are output one by one without a string buffer and printf(). The number is not truncated if it is wider than the field.
+ * \param value A number
+ * \param width Minimum field width, the number is right-aligned
+ * \param pad Padding symbol, e.g. <tt>' '</tt> or <tt>'0'</tt>
+ */
+void lcd_put_u16(const uint16_t value, const uint8_t width, const char pad);
+
+/**
+ * \brief Outputs an unsigned number from the current address, see #lcd_put_u16()
+ * \param value A number
+ * \param width Minimum field width, the number is right-aligned
+ * \param pad Padding symbol
+ */
+void lcd_put_u32(const uint32_t value, const uint8_t width, const char pad);
+
+/**
+ * \brief Outputs a signed number from the current address, see #lcd_put_u16()
+ * \details With the <tt>'0'</tt> padding the sign goes before the zeros.
+ * \param value A number
+ * \param width Minimum field width including the sign
+ * \param pad Padding symbol
+ */
+void lcd_put_i32(const int32_t value, const uint8_t width, const char pad);
+
+/**
+ * \brief Outputs a fixed-point number from the current address, see #lcd_put_i32()
+ * \details E.g. the value 2150 with two fractional digits is output as <tt>21.50</tt>, the value -5 as <tt>-0.05</tt>.
+ * \param value The number multiplied by 10<sup>frac_digits</sup>
+ * \param frac_digits Number of the fractional digits 0-9
+ * \param width Minimum field width including the sign and the point
+ * \param pad Padding symbol
+ */
+void lcd_put_fixed(const int32_t value, const uint8_t frac_digits, const uint8_t width, const char pad);
+
+/**
+ * \brief Creates a custom symbol.
+ * \param char_pos Char position 0-7.
+ * \param custom_char 8-byte array with symbol information.
+ * \remark Once executed, no output will be possible until the DDRAM address is set. The DDRAM address can be set using the following methods: #lcd_ddr_adr(), #lcd_set_pos() and #lcd_clear().
+ */
+void lcd_custom_char(const byte_t char_pos, const byte_t custom_char[8]);
+
+/**
+ * \brief Loads consecutive custom symbols from flash after a single CGRAM address command.
+ * \details The DDRAM address is restored afterwards, as tracked with #LCD_HD44780_PIN_TRACK_ADDR or read back with RW. Otherwise it is not restored, see #lcd_custom_char(). With #LCD_HD44780_PIN_GLYPH_CACHE the loaded slots are no longer known to the cache.
+ * \param first_slot The slot of the first symbol 0-7.
+ * \param glyphs Symbols of 8 bytes each in flash.
+ * \param count Number of the symbols, the symbols beyond the slot 7 are not loaded.
+ */
+void lcd_load_glyph_set(const byte_t first_slot, const __flash byte_t glyphs[][8], const uint8_t count);
+
+#		if LCD_HD44780_PIN_GLYPH_CACHE || __DOXYGEN__
+#			define LCD_GLYPH_NONE				0xFF /**< \brief Returned by #lcd_glyph() when all the slots are pinned. */
+
+/**
+ * \brief Makes the glyph resident in CGRAM.
+ * \details The glyph is identified by its address in flash. It is uploaded only if it is not in one of the slots yet, then the DDRAM address is restored. Without RW the address can't be restored after the decrement or shift entry modes. A slot written by #lcd_custom_char() is no longer known to the cache. See #LCD_HD44780_PIN_GLYPH_CACHE
+ * \param glyph 8 rows of the glyph in flash
+ * \return The symbol code 0-7 to output the glyph, or #LCD_GLYPH_NONE
+ */
+byte_t lcd_glyph(const __flash byte_t glyph[8]);
+
+/**
+ * \brief Makes the glyph resident in CGRAM and keeps it there until #lcd_glyph_unpin(), see #lcd_glyph()
+ * \param glyph 8 rows of the glyph in flash
+ * \return The symbol code 0-7 to output the glyph, or #LCD_GLYPH_NONE
+ */
+byte_t lcd_glyph_pin(const __flash byte_t glyph[8]);
+
+/**
+ * \brief Allows the slot of the glyph to be replaced again
+ * \param glyph 8 rows of the glyph in flash
+ */
+void lcd_glyph_unpin(const __flash byte_t glyph[8]);
+
+/**
+ * \brief Forgets all the resident and pinned glyphs.
+ * \details Called by #lcd_init(). Call it if CGRAM was written bypassing the cache.
+ */
+void lcd_glyph_invalidate(void);
+
+#			if LCD_HD44780_PIN_UTF8 || __DOXYGEN__
+/** \brief A glyph for a character missing in the ROM, see #lcd_utf8_glyphs() */
+typedef struct {
+	uint16_t code_point; /**< \brief Unicode code point */
+	byte_t glyph[8]; /**< \brief 8 rows of the glyph */
+} lcd_utf8_glyph_t;
+
+/**
+ * \brief Sets the glyphs for the characters missing in the ROM.
+ * \details A glyph is made resident by #lcd_glyph() when its character is output, #LCD_HD44780_PIN_UTF8_MISSING is output if all the slots are pinned. The table is searched only for the missing characters. See #LCD_HD44780_PIN_UTF8
+ * \param glyphs Glyph table in flash, NULL to disable
+ * \param count Number of the glyphs
+ */
+void lcd_utf8_glyphs(const __flash lcd_utf8_glyph_t glyphs[], const uint8_t count);
+#			endif // LCD_HD44780_PIN_UTF8
+#		endif // LCD_HD44780_PIN_GLYPH_CACHE
+
+#		if LCD_HD44780_PIN_SHADOW || __DOXYGEN__
+/**
+ * \brief Sends the postponed DDRAM address to the controller.
+ * \details With #LCD_HD44780_PIN_SHADOW the DDRAM address is sent only before the next changed cell. Call this if the visible cursor should be placed right now.
+ */
+void lcd_sync(void);
+
+/**
+ * \brief Marks all shadow cells as unknown.
+ * \details The next output to each cell will be sent to the display even if it has not changed. Useful if the display contents could have been corrupted, e.g. after a power glitch.
+ */
+void lcd_shadow_invalidate(void);
+#		endif // LCD_HD44780_PIN_SHADOW
+
+#		if LCD_HD44780_PIN_ASYNC || __DOXYGEN__
+/**
+ * \brief Sends the next queued byte to the controller if it is ready.
+ * \details It should be called from a timer interrupt every #LCD_HD44780_PIN_ASYNC_TICK_US. See #LCD_HD44780_PIN_ASYNC
+ */
+void lcd_async_proc(void);
+
+/**
+ * \brief Waits until all queued output is sent and executed by the controller.
+ * \details If the global interrupts are disabled, the queue is sent right away by this function.
+ */
+void lcd_flush(void);
+
+/**
+ * \brief Returns the number of bytes that can be queued without waiting.
+ * \details Every symbol and every command takes one byte.
+ * \return Free queue entries
+ */
+uint8_t lcd_queue_free(void);
+#		endif // LCD_HD44780_PIN_ASYNC
+
 #		if LCD_HD44780_PIN_ALLOW_RW || __DOXYGEN__
 /**
  * \brief Waits until display is buisy and returns address counter contents.
@@ -501,6 +1196,26 @@ byte_t lcd_read_busy_and_addr();
  */
 byte_t lcd_read_data();
 #		endif
+
+#		if LCD_HD44780_PIN_DUAL_NIBBLE || __DOXYGEN__
+/**
+ * \brief Outputs a symbol to each display of the pair
+ * \details See #LCD_HD44780_PIN_DUAL_NIBBLE
+ * \param ch1 Symbol code for the display on the low nibble
+ * \param ch2 Symbol code for the display on the high nibble
+ */
+void lcd_pair_byte(const byte_t ch1, const byte_t ch2);
+
+/**
+ * \brief Outputs a string to each display of the pair on entry line
+ * \details See #LCD_HD44780_PIN_DUAL_NIBBLE
+ * \param str1 A string for the display on the low nibble
+ * \param str2 A string for the display on the high nibble
+ * \param line Display row
+ * \param start_pos Starts with the display column
+ */
+void lcd_pair_line(const char str1[], const char str2[], const lcd_line_t line, const uint8_t start_pos);
+#		endif // LCD_HD44780_PIN_DUAL_NIBBLE
 #	endif // LCD_HD44780_PIN_SINGLE_SOME_CODE
 #endif // LCD_HD44780_PIN_MULTI_MODE
 
@@ -0,0 +1,126 @@
+// ---------------------------------------------------------------------------+
+//					This file is part of SLS AVR Library
+//				https://github.com/SimonLitt/sls-avr-lib
+// ---------------------------------------------------------------------------+
+// Copyright (C) 2025 Simon Litt <simon@1itt.net> https://coding.1itt.net,
+// 												  https://github.com/SimonLitt
+//
+// This program is free software: you can redistribute it and/or modify it
+// under the terms of the GNU General Public License as published by the Free
+// Software Foundation, version 3.
+//
+// This program is distributed in the hope that it will be useful, but WITHOUT
+// ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+// FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License for
+// more details.
+//
+// You should have received a copy of the GNU General Public License along
+// with this program. If not, see <https://www.gnu.org/licenses/>.
+// ---------------------------------------------------------------------------+
+/**
+ * \author		Simon Litt <simon@1itt.net> https://coding.1itt.net,
+ *              							https://github.com/SimonLitt
+ * \copyright	GNU General Public License v3.0
+ * \file		sls-avr/lcd_marquee.h
+ * \brief		Scrolling text by the display shift of the controller.
+ * \details		Built on top of sls-avr/lcd_hd44780_pin.h and uses the same configuration. In multidisplay mode the functions take the #lcd_info_t reference first.
+ *
+ * The text is written once into the whole DDRAM row, 40 cells for 2-line displays and 80 cells for 1-line ones, the visible window is then moved over it by one shift command per step.
+ * \remark The controller shifts all the rows together, so the other row of a 2-line display scrolls too. 4-line displays are not supported, their rows 1 and 3 share one DDRAM row. The single display mode rejects them at compile time, in the multidisplay mode #lcd_marquee_text() returns 0 and #lcd_marquee_start() keeps the text still for them.
+ * \remark A step sends a command, so #lcd_marquee_tick() should not interrupt other output to the same display.
+ *
+ * \code
+ * #include <sls-avr/lcd_marquee.h>
+ * ...
+ * static lcd_marquee_t ticker;
+ * volatile bool tick; // Set by a timer interrupt, e.g. every 10 ms
+ *
+ * int main(void) {
+ *		...
+ *		uint8_t len = lcd_marquee_text_P(LCD_ROW_1, PSTR("Boiler 1: 65C, boiler 2: off"));
+ *		lcd_marquee_start(&ticker, len, LCD_MARQUEE_WRAP, 30); // A step every 300 ms
+ *		while (1) {
+ *			if (tick) {
+ *				tick = false;
+ *				lcd_marquee_tick(&ticker);
+ *			}
+ *			...
+ *		}
+ * }
+ * \endcode
+ */
+#ifndef SLS_AVR_LCD_MARQUEE_H_
+#define SLS_AVR_LCD_MARQUEE_H_
+
+#include <stdbool.h>
+#include <stdint.h>
+#include <sls-avr/lcd_hd44780_pin.h>
+
+/** \brief Scrolling mode */
+typedef enum {
+	LCD_MARQUEE_WRAP = 0, /**< \brief The text runs to the left endlessly, the end of the DDRAM row is followed by its start */
+	LCD_MARQUEE_BOUNCE, /**< \brief The text runs to the left until its end is visible, then back */
+} lcd_marquee_mode_t;
+
+/** \brief Scrolling state */
+typedef struct {
+	uint8_t period; /**< \brief Number of ticks per step */
+	uint8_t ticks; /**< \brief Ticks since the last step */
+	uint8_t mode; /**< \brief #lcd_marquee_mode_t */
+	uint8_t span; /**< \brief Number of steps to the end, 0 for still text */
+	uint8_t shift; /**< \brief Current display shift to the left */
+	bool back; /**< \brief #LCD_MARQUEE_BOUNCE goes to the right */
+} lcd_marquee_t;
+
+/**
+ * \brief Writes a text into the whole DDRAM row, including the invisible cells
+ * \details The rest of the row is filled with spaces, the text is truncated to the DDRAM row length.
+ * \param info #lcd_info_t reference, multidisplay mode only.
+ * \param line Display row
+ * \param str A string
+ * \return The written text length, 0 for a 4-line display
+ */
+uint8_t lcd_marquee_text(__LCD_MULTIMODE_ONLY_INFO_ARG_WITH_COMMA(info) const lcd_line_t line, const char str[]);
+
+/**
+ * \brief Writes a program memory text into the whole DDRAM row, see #lcd_marquee_text()
+ * \param info #lcd_info_t reference, multidisplay mode only.
+ * \param line Display row
+ * \param str A string in program memory
+ * \return The written text length, 0 for a 4-line display
+ */
+uint8_t lcd_marquee_text_P(__LCD_MULTIMODE_ONLY_INFO_ARG_WITH_COMMA(info) const lcd_line_t line, const char str[]);
+
+/**
+ * \brief Resets the display shift and starts scrolling
+ * \param info #lcd_info_t reference, multidisplay mode only.
+ * \param marquee Scrolling state
+ * \param len The longest text length of the rows, as returned by #lcd_marquee_text(). #LCD_MARQUEE_BOUNCE does not scroll a text that fits the display.
+ * \param mode #lcd_marquee_mode_t
+ * \param period Number of #lcd_marquee_tick() calls per step, 1-255
+ */
+void lcd_marquee_start(__LCD_MULTIMODE_ONLY_INFO_ARG_WITH_COMMA(info) lcd_marquee_t *const marquee, const uint8_t len, const lcd_marquee_mode_t mode, const uint8_t period);
+
+/**
+ * \brief Shifts the display by one cell
+ * \param info #lcd_info_t reference, multidisplay mode only.
+ * \param marquee Scrolling state
+ */
+void lcd_marquee_step(__LCD_MULTIMODE_ONLY_INFO_ARG_WITH_COMMA(info) lcd_marquee_t *const marquee);
+
+/**
+ * \brief Counts a tick and makes a step every lcd_marquee_t::period ticks
+ * \param info #lcd_info_t reference, multidisplay mode only.
+ * \param marquee Scrolling state
+ * \return The display was shifted
+ */
+bool lcd_marquee_tick(__LCD_MULTIMODE_ONLY_INFO_ARG_WITH_COMMA(info) lcd_marquee_t *const marquee);
+
+/**
+ * \brief Stops scrolling and resets the display shift by #lcd_home()
+ * \param info #lcd_info_t reference, multidisplay mode only.
+ * \param marquee Scrolling state
+ */
+void lcd_marquee_stop(__LCD_MULTIMODE_ONLY_INFO_ARG_WITH_COMMA(info) lcd_marquee_t *const marquee);
+
+#endif /* SLS_AVR_LCD_MARQUEE_H_ */
@@ -0,0 +1,102 @@
+// ---------------------------------------------------------------------------+
+//					This file is part of SLS AVR Library
+//				https://github.com/SimonLitt/sls-avr-lib
+// ---------------------------------------------------------------------------+
+// Copyright (C) 2025 Simon Litt <simon@1itt.net> https://coding.1itt.net,
+// 												  https://github.com/SimonLitt
+//
+// This program is free software: you can redistribute it and/or modify it
+// under the terms of the GNU General Public License as published by the Free
+// Software Foundation, version 3.
+//
+// This program is distributed in the hope that it will be useful, but WITHOUT
+// ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+// FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License for
+// more details.
+//
+// You should have received a copy of the GNU General Public License along
+// with this program. If not, see <https://www.gnu.org/licenses/>.
+// ---------------------------------------------------------------------------+
+/**
+ * \author		Simon Litt <simon@1itt.net> https://coding.1itt.net,
+ *              							https://github.com/SimonLitt
+ * \copyright	GNU General Public License v3.0
+ * \file		sls-avr/lcd_stdio.h
+ * \brief		Standard IO output to the display like a small terminal.
+ * \details		Built on top of sls-avr/lcd_hd44780_pin.h and uses the same configuration. In multidisplay mode #lcd_stream_open() takes the #lcd_info_t reference first.
+ *
+ * The stream keeps its own cursor, so the text wraps to the next row at the end of a row and to the first row after the last one. The symbols of a row are collected
+ * and sent as one block on a control symbol, on the wrap, when the buffer is full or by #lcd_stream_flush().
+ *
+ * Control symbols:
+ *	- \c \\n erases the rest of the row and moves to the beginning of the next row;
+ *	- \c \\r moves to the beginning of the row, <tt>\\r\\n</tt> ends the line the same as \c \\n and keeps the symbols written before;
+ *	- \c \\b moves one column back;
+ *	- \c \\f clears the display and moves home.
+ *
+ * ANSI escape sequences:
+ *	- <tt>ESC [ row ; col H</tt> moves to the position counting from 1, <tt>ESC [ H</tt> moves home;
+ *	- <tt>ESC [ K</tt> erases the rest of the row, <tt>ESC [ 1 K</tt> erases the row up to the cursor, <tt>ESC [ 2 K</tt> erases the whole row;
+ *	- <tt>ESC [ 2 J</tt> clears the display.
+ *
+ * \code
+ * #include <sls-avr/lcd_stdio.h>
+ * ...
+ * static lcd_stream_t lcd_out;
+ *
+ * int main(void) {
+ *		...
+ *		lcd_init(&cfg);
+ *		stdout = lcd_stream_open(&lcd_out);
+ *		printf("\fTemp: %d.%d\nRPM: %u\n", t / 10, t % 10, rpm);
+ *		printf("\x1b[2;6H%5u", rpm);
+ *		lcd_stream_flush(&lcd_out);
+ *		...
+ * }
+ * \endcode
+ *
+ * \remark Other output to the display does not move the cursor of the stream.
+ */
+#ifndef SLS_AVR_LCD_STDIO_H_
+#define SLS_AVR_LCD_STDIO_H_
+
+#include <stdio.h>
+#include <stdint.h>
+#include <sls-avr/lcd_hd44780_pin.h>
+
+#ifndef LCD_STDIO_BUF_SIZE
+#	define LCD_STDIO_BUF_SIZE		20 /**< \brief The longest block sent at once, the buffer is flushed when it is full. */
+#endif // LCD_STDIO_BUF_SIZE
+
+/** \brief Display stream */
+typedef struct {
+	FILE file; /**< \brief The stream returned by #lcd_stream_open() */
+#if LCD_HD44780_PIN_MULTI_MODE || __DOXYGEN__
+	const lcd_info_t *info; /**< \brief The display, multidisplay mode only */
+#endif
+	uint8_t rows; /**< \brief Display rows */
+	uint8_t cols; /**< \brief Display columns */
+	uint8_t row; /**< \brief Cursor row */
+	uint8_t col; /**< \brief Cursor column */
+	uint8_t len; /**< \brief Buffered symbols, they end at the cursor */
+	uint8_t esc; /**< \brief Escape sequence state */
+	uint8_t args[2]; /**< \brief Escape sequence numbers */
+	uint8_t cr_col; /**< \brief The cursor column before a \c \\r just received, 0xFF otherwise */
+	byte_t buf[LCD_STDIO_BUF_SIZE]; /**< \brief Symbols not sent yet */
+} lcd_stream_t;
+
+/**
+ * \brief Sets up the stream, the cursor is at home
+ * \param info #lcd_info_t reference, multidisplay mode only.
+ * \param stream Stream state
+ * \return The stream for \c stdout, \c stderr or \c fprintf()
+ */
+FILE *lcd_stream_open(__LCD_MULTIMODE_ONLY_INFO_ARG_WITH_COMMA(info) lcd_stream_t *const stream);
+
+/**
+ * \brief Sends the buffered symbols
+ * \param stream Stream state
+ */
+void lcd_stream_flush(lcd_stream_t *const stream);
+
+#endif /* SLS_AVR_LCD_STDIO_H_ */
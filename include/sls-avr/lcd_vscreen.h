@@ -0,0 +1,126 @@
+// ---------------------------------------------------------------------------+
+//					This file is part of SLS AVR Library
+//				https://github.com/SimonLitt/sls-avr-lib
+// ---------------------------------------------------------------------------+
+// Copyright (C) 2025 Simon Litt <simon@1itt.net> https://coding.1itt.net,
+// 												  https://github.com/SimonLitt
+//
+// This program is free software: you can redistribute it and/or modify it
+// under the terms of the GNU General Public License as published by the Free
+// Software Foundation, version 3.
+//
+// This program is distributed in the hope that it will be useful, but WITHOUT
+// ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+// FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License for
+// more details.
+//
+// You should have received a copy of the GNU General Public License along
+// with this program. If not, see <https://www.gnu.org/licenses/>.
+// ---------------------------------------------------------------------------+
+/**
+ * \author		Simon Litt <simon@1itt.net> https://coding.1itt.net,
+ *              							https://github.com/SimonLitt
+ * \copyright	GNU General Public License v3.0
+ * \file		sls-avr/lcd_vscreen.h
+ * \brief		A virtual text screen larger than the display with a movable viewport.
+ * \details		Built on top of sls-avr/lcd_hd44780_pin.h and uses the same configuration. In multidisplay mode the functions that output take the #lcd_info_t reference first.
+ *
+ * The screen cells are kept in SRAM. The display contents are mirrored in a panel buffer, so only the cells that differ are sent when the viewport moves or the screen changes.
+ * With #LCD_HD44780_PIN_SHADOW the driver already compares the cells, so the panel buffer can be omitted.
+ *
+ * \code
+ * #include <sls-avr/lcd_vscreen.h>
+ * ...
+ * static byte_t log_cells[8 * 40];
+ * static byte_t log_panel[4 * 20]; // The display size
+ * static lcd_vscreen_t log_screen;
+ *
+ * int main(void) {
+ *		...
+ *		lcd_vscreen_init(&log_screen, log_cells, 40, 8, log_panel);
+ *		lcd_vscreen_line(&log_screen, 0, "12:00 boiler on");
+ *		...
+ *		lcd_vscreen_view(&log_screen, top, 0); // On a button press
+ * }
+ * \endcode
+ */
+#ifndef SLS_AVR_LCD_VSCREEN_H_
+#define SLS_AVR_LCD_VSCREEN_H_
+
+#include <stdbool.h>
+#include <stdint.h>
+#include <sls-avr/lcd_hd44780_pin.h>
+
+/** \brief Virtual screen */
+typedef struct {
+	byte_t *cells; /**< \brief Screen cells, width * height, row by row */
+	byte_t *panel; /**< \brief Display cells as sent, rows * cols, or NULL */
+	uint8_t width; /**< \brief Screen width, not less than the display */
+	uint8_t height; /**< \brief Screen height, not less than the display */
+	uint8_t rows; /**< \brief Display rows */
+	uint8_t cols; /**< \brief Display columns */
+	uint8_t top; /**< \brief The screen row in the top display row */
+	uint8_t left; /**< \brief The screen column in the left display column */
+	bool valid; /**< \brief The panel buffer matches the display */
+} lcd_vscreen_t;
+
+/**
+ * \brief Initializes a virtual screen filled with spaces, the viewport is at the top left corner
+ * \param info #lcd_info_t reference, multidisplay mode only.
+ * \param vscreen Virtual screen
+ * \param cells Screen cells buffer, width * height bytes
+ * \param width Screen width, not less than the display columns
+ * \param height Screen height, not less than the display rows
+ * \param panel Display mirror buffer, rows * cols bytes, or NULL to send the whole rows
+ */
+void lcd_vscreen_init(__LCD_MULTIMODE_ONLY_INFO_ARG_WITH_COMMA(info) lcd_vscreen_t *const vscreen, byte_t cells[], const uint8_t width, const uint8_t height, byte_t panel[]);
+
+/**
+ * \brief Fills the screen with spaces, the display is updated by #lcd_vscreen_redraw()
+ * \param vscreen Virtual screen
+ */
+void lcd_vscreen_clear(lcd_vscreen_t *const vscreen);
+
+/**
+ * \brief Writes a string into the screen, clipped by the screen width
+ * \details The display is updated by #lcd_vscreen_redraw().
+ * \param vscreen Virtual screen
+ * \param row Screen row
+ * \param col Screen column
+ * \param str A string
+ */
+void lcd_vscreen_text(lcd_vscreen_t *const vscreen, const uint8_t row, const uint8_t col, const char str[]);
+
+/**
+ * \brief Replaces a whole screen row, the rest of the row is filled with spaces
+ * \details The display is updated by #lcd_vscreen_redraw().
+ * \param vscreen Virtual screen
+ * \param row Screen row
+ * \param str A string
+ */
+void lcd_vscreen_line(lcd_vscreen_t *const vscreen, const uint8_t row, const char str[]);
+
+/**
+ * \brief Sends the visible cells that differ from the display
+ * \param info #lcd_info_t reference, multidisplay mode only.
+ * \param vscreen Virtual screen
+ */
+void lcd_vscreen_redraw(__LCD_MULTIMODE_ONLY_INFO_ARG_WITH_COMMA(info) lcd_vscreen_t *const vscreen);
+
+/**
+ * \brief Moves the viewport and redraws the display
+ * \details The viewport is kept inside the screen.
+ * \param info #lcd_info_t reference, multidisplay mode only.
+ * \param vscreen Virtual screen
+ * \param top The screen row in the top display row
+ * \param left The screen column in the left display column
+ */
+void lcd_vscreen_view(__LCD_MULTIMODE_ONLY_INFO_ARG_WITH_COMMA(info) lcd_vscreen_t *const vscreen, const uint8_t top, const uint8_t left);
+
+/**
+ * \brief Forces all the visible cells to be sent by the next redraw, e.g. after other output to the display
+ * \param vscreen Virtual screen
+ */
+void lcd_vscreen_invalidate(lcd_vscreen_t *const vscreen);
+
+#endif /* SLS_AVR_LCD_VSCREEN_H_ */
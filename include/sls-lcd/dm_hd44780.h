@@ -46,22 +46,132 @@
 #	define HD44780_WAIT_INIT_MS			18 /**< \brief Waiting before initialization, ms. */
 #endif
 
-#ifndef HD44780_EXEC_TIME_US
-#	define HD44780_EXEC_TIME_US			50 /**< \brief Waiting after command, us. */
+#define HD44780_CONTROLLER_GENERIC		0 /**< \brief Unknown compatible controller, the worst case timings of all supported. */
+#define HD44780_CONTROLLER_HD44780U		1 /**< \brief Hitachi HD44780U. */
+#define HD44780_CONTROLLER_KS0066		2 /**< \brief Samsung KS0066 (S6A0069). */
+#define HD44780_CONTROLLER_ST7066U		3 /**< \brief Sitronix ST7066U. */
+#define HD44780_CONTROLLER_SPLC780D		4 /**< \brief Sunplus SPLC780D. */
+
+#ifndef HD44780_CONTROLLER
+#	define HD44780_CONTROLLER			HD44780_CONTROLLER_GENERIC /**< \brief Controller timing profile. \details One of: #HD44780_CONTROLLER_GENERIC, #HD44780_CONTROLLER_HD44780U, #HD44780_CONTROLLER_KS0066, #HD44780_CONTROLLER_ST7066U, #HD44780_CONTROLLER_SPLC780D. Any of the timings below can still be defined separately. */
 #endif
 
-#ifndef HD44780_LONG_EXEC_TIME_US
-#	define HD44780_LONG_EXEC_TIME_US	1760 /**< \brief Waiting after long command, us. */
+#ifndef HD44780_VCC_MV
+#	define HD44780_VCC_MV				5000 /**< \brief Controller supply voltage, mV. \details Below 4500 mV the 3.3 V bus timings of the profile are used. */
 #endif
 
-#ifndef HD44780_ENABLE_PULSE_US			// 1.5/250000 = 0.6 us
-#	define HD44780_ENABLE_PULSE_US		0.8 /**< \brief Duration of E(enable) pulsation, us. */
+#ifndef HD44780_OSC_KHZ
+#	define HD44780_OSC_KHZ				270 /**< \brief Controller oscillator frequency, kHz. \details The execution times of a profile are given for the nominal 270 kHz and scaled by this value. Specify the lowest expected frequency of the modules for a margin. */
 #endif
 
+#if HD44780_CONTROLLER == HD44780_CONTROLLER_GENERIC
+#	ifndef HD44780_EXEC_TIME_US
+#		define HD44780_EXEC_TIME_US			50 /**< \brief Waiting after command, us. \details The longest of #HD44780_CMD_EXEC_TIME_US and #HD44780_DATA_EXEC_TIME_US with a controller profile. */
+#	endif
+
+#	ifndef HD44780_LONG_EXEC_TIME_US
+#		define HD44780_LONG_EXEC_TIME_US	1760 /**< \brief Waiting after long command, us. \details The longest of #HD44780_CLEAR_EXEC_TIME_US and #HD44780_HOME_EXEC_TIME_US with a controller profile. */
+#	endif
+
+#	ifndef HD44780_ENABLE_PULSE_US			// 1.5/250000 = 0.6 us
+#		define HD44780_ENABLE_PULSE_US		0.8 /**< \brief Duration of E(enable) pulsation, us. */
+#	endif
+
+#	ifndef HD44780_CMD_EXEC_TIME_US
+#		define HD44780_CMD_EXEC_TIME_US		HD44780_EXEC_TIME_US /**< \brief Waiting after entry mode, display control, shift, function set and address commands, us. */
+#	endif
+
+#	ifndef HD44780_DATA_EXEC_TIME_US
+#		define HD44780_DATA_EXEC_TIME_US	HD44780_EXEC_TIME_US /**< \brief Waiting after writing data to CGRAM or DDRAM, us. */
+#	endif
+
+#	ifndef HD44780_CLEAR_EXEC_TIME_US
+#		define HD44780_CLEAR_EXEC_TIME_US	HD44780_LONG_EXEC_TIME_US /**< \brief Waiting after clear display, us. */
+#	endif
+
+#	ifndef HD44780_HOME_EXEC_TIME_US
+#		define HD44780_HOME_EXEC_TIME_US	HD44780_LONG_EXEC_TIME_US /**< \brief Waiting after return home, us. */
+#	endif
+#else
+/** \cond NO_DOC */
+// Datasheet values at 270 kHz. Data writes include the address counter update time (tADD).
+#	if HD44780_CONTROLLER == HD44780_CONTROLLER_HD44780U
+#		define __HD44780_PROF_CMD_US		37
+#		define __HD44780_PROF_DATA_US		41
+#		define __HD44780_PROF_CLEAR_US		1520
+#		define __HD44780_PROF_HOME_US		1520
+#		define __HD44780_PROF_E_5V_US		0.25 // Half of the 500 ns enable cycle, PWEH 230 ns
+#		define __HD44780_PROF_E_3V_US		0.5 // Half of the 1000 ns enable cycle, PWEH 450 ns
+#	elif HD44780_CONTROLLER == HD44780_CONTROLLER_KS0066
+#		define __HD44780_PROF_CMD_US		39
+#		define __HD44780_PROF_DATA_US		43
+#		define __HD44780_PROF_CLEAR_US		1530
+#		define __HD44780_PROF_HOME_US		1530
+#		define __HD44780_PROF_E_5V_US		0.25
+#		define __HD44780_PROF_E_3V_US		0.5
+#	elif HD44780_CONTROLLER == HD44780_CONTROLLER_ST7066U
+#		define __HD44780_PROF_CMD_US		37
+#		define __HD44780_PROF_DATA_US		41
+#		define __HD44780_PROF_CLEAR_US		1520
+#		define __HD44780_PROF_HOME_US		1520
+#		define __HD44780_PROF_E_5V_US		0.6 // Half of the 1200 ns enable cycle
+#		define __HD44780_PROF_E_3V_US		0.7 // Half of the 1400 ns enable cycle
+#	elif HD44780_CONTROLLER == HD44780_CONTROLLER_SPLC780D
+#		define __HD44780_PROF_CMD_US		37
+#		define __HD44780_PROF_DATA_US		41
+#		define __HD44780_PROF_CLEAR_US		1520
+#		define __HD44780_PROF_HOME_US		1520
+#		define __HD44780_PROF_E_5V_US		0.25
+#		define __HD44780_PROF_E_3V_US		0.5
+#	else
+#		error "Unknown HD44780_CONTROLLER!"
+#	endif
+
+#	define __HD44780_OSC_SCALE(_us)		(((_us) * 270UL + HD44780_OSC_KHZ - 1) / HD44780_OSC_KHZ)
+#	define __HD44780_MAX(_a, _b)			((_a) > (_b) ? (_a) : (_b))
+/** \endcond */
+
+#	ifndef HD44780_CMD_EXEC_TIME_US
+#		define HD44780_CMD_EXEC_TIME_US		__HD44780_OSC_SCALE(__HD44780_PROF_CMD_US)
+#	endif
+
+#	ifndef HD44780_DATA_EXEC_TIME_US
+#		define HD44780_DATA_EXEC_TIME_US	__HD44780_OSC_SCALE(__HD44780_PROF_DATA_US)
+#	endif
+
+#	ifndef HD44780_CLEAR_EXEC_TIME_US
+#		define HD44780_CLEAR_EXEC_TIME_US	__HD44780_OSC_SCALE(__HD44780_PROF_CLEAR_US)
+#	endif
+
+#	ifndef HD44780_HOME_EXEC_TIME_US
+#		define HD44780_HOME_EXEC_TIME_US	__HD44780_OSC_SCALE(__HD44780_PROF_HOME_US)
+#	endif
+
+#	ifndef HD44780_EXEC_TIME_US
+#		define HD44780_EXEC_TIME_US			__HD44780_MAX(HD44780_CMD_EXEC_TIME_US, HD44780_DATA_EXEC_TIME_US)
+#	endif
+
+#	ifndef HD44780_LONG_EXEC_TIME_US
+#		define HD44780_LONG_EXEC_TIME_US	__HD44780_MAX(HD44780_CLEAR_EXEC_TIME_US, HD44780_HOME_EXEC_TIME_US)
+#	endif
+
+#	ifndef HD44780_ENABLE_PULSE_US
+#		if HD44780_VCC_MV < 4500
+#			define HD44780_ENABLE_PULSE_US	__HD44780_PROF_E_3V_US
+#		else
+#			define HD44780_ENABLE_PULSE_US	__HD44780_PROF_E_5V_US
+#		endif
+#	endif
+#endif // HD44780_CONTROLLER
+
 #ifndef HD44780_WAIT_BF_LOOP_US
 #	define HD44780_WAIT_BF_LOOP_US		0 /**< \brief Additional waiting in wait BF loop, us. 0 - waint only 2 x #HD44780_ENABLE_PULSE_US for 8-bit IDL and 4 x #HD44780_ENABLE_PULSE_US for 4-bit IDL */
 #endif
 
+#ifndef HD44780_ADD_US
+#	define HD44780_ADD_US				4 /**< \brief Address counter update time after the busy flag is cleared (tADD), us. \details Added to the calibrated execution time of data writes, see LCD_HD44780_PIN_CALIBRATE in sls-avr/lcd_hd44780_pin.h. */
+#endif
+
 #ifndef HD44780_INIT_1_MS
 #	define HD44780_INIT_1_MS 			5 /**< \brief Waiting after first initialization command, ms. */
 #endif
@@ -232,6 +342,10 @@
 
 #define __HD44780_ROW_3_20x4_DDRAM_ADR	0x14
 #define __HD44780_ROW_4_20x4_DDRAM_ADR	0x54
+
+#define __HD44780_1L_LAST_DDRAM_ADR		0x4F // The address counter wraps after it in 1-line mode
+#define __HD44780_2L_ROW_1_LAST_DDRAM_ADR	0x27 // The address counter jumps to row 2 after it in 2-line mode
+#define __HD44780_2L_ROW_2_LAST_DDRAM_ADR	0x67 // The address counter wraps after it in 2-line mode
 /** \endcond */
 #	ifndef HD44780_ROW_1_DDRAM_ADR
 #		define HD44780_ROW_1_DDRAM_ADR __HD44780_ROW_1_DDRAM_ADR /**< \brief Default row 1 DDRAM adress. */
@@ -272,6 +386,9 @@
 #define HD44780_CUSTOM_CHAR_6			6 /**< \brief Custom char 6. */
 #define HD44780_CUSTOM_CHAR_7			7 /**< \brief Custom char 7. */
 
+#define HD44780_ROM_A00					1 /**< \brief Character generator ROM code A00: ASCII, Japanese katakana and some Greek symbols. */
+#define HD44780_ROM_A02					2 /**< \brief Character generator ROM code A02: ASCII, Western European and Cyrillic. */
+
 // ---------------------------------------------------------------------------+
 /** \brief LCD row. */
 typedef enum {
@@ -306,4 +423,15 @@ typedef enum {
 	//LCD_40X4	= HD44780_DISPLAY_40X4, /**< \brief Resolution 40х4 characters */
 } lcd_display_t;
 
+/** \cond NO_DOC */
+// Display geometry as constant expressions, e.g. for static initializers.
+#define __HD44780_DISPLAY_ROWS(_t)		(((_t) < HD44780_DISPLAY_16X2) ? 1 : (((_t) < HD44780_DISPLAY_16X4) ? 2 : 4))
+#define __HD44780_DISPLAY_COLS(_t)		(((_t) == HD44780_DISPLAY_8X1) ? 8 : \
+										(((_t) == HD44780_DISPLAY_20X2) || ((_t) == HD44780_DISPLAY_20X4)) ? 20 : \
+										((_t) == HD44780_DISPLAY_32X2) ? 32 : \
+										(((_t) == HD44780_DISPLAY_40X2) || ((_t) == HD44780_DISPLAY_40X4)) ? 40 : 16)
+#define __HD44780_DISPLAY_ROW_3_ADR(_t)	(((_t) == HD44780_DISPLAY_20X4) ? HD44780_ROW_3_20x4_DDRAM_ADR : HD44780_ROW_3_DDRAM_ADR)
+#define __HD44780_DISPLAY_ROW_4_ADR(_t)	(((_t) == HD44780_DISPLAY_20X4) ? HD44780_ROW_4_20x4_DDRAM_ADR : HD44780_ROW_4_DDRAM_ADR)
+/** \endcond */
+
 #endif // SLS_LCD_DM_HD44780_H_
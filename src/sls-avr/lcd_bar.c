@@ -0,0 +1,133 @@
+// ---------------------------------------------------------------------------+
+//					This file is part of SLS AVR Library
+//				https://github.com/SimonLitt/sls-avr-lib
+// ---------------------------------------------------------------------------+
+// Copyright (C) 2025 Simon Litt <simon@1itt.net> https://coding.1itt.net,
+// 												  https://github.com/SimonLitt
+//
+// This program is free software: you can redistribute it and/or modify it
+// under the terms of the GNU General Public License as published by the Free
+// Software Foundation, version 3.
+//
+// This program is distributed in the hope that it will be useful, but WITHOUT
+// ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+// FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License for
+// more details.
+//
+// You should have received a copy of the GNU General Public License along
+// with this program. If not, see <https://www.gnu.org/licenses/>.
+// ---------------------------------------------------------------------------+
+#include <sls-avr/lcd_bar.h>
+
+#define __BAR_GLYPH(_m)			{(_m), (_m), (_m), (_m), (_m), (_m), (_m), 0x00} // The cursor row is left blank
+
+static const __flash byte_t _lcd_bar_glyphs[][8] = {
+	__BAR_GLYPH(0x10), __BAR_GLYPH(0x18), __BAR_GLYPH(0x1C), __BAR_GLYPH(0x1E), // 1-4 columns from the left
+#if LCD_BAR_CENTER_ZERO
+	__BAR_GLYPH(0x01), __BAR_GLYPH(0x03), __BAR_GLYPH(0x07), __BAR_GLYPH(0x0F), // 1-4 columns from the right
+#else
+	__BAR_GLYPH(0x1F),
+#endif
+};
+#define __BAR_GLYPH_COUNT		(sizeof(_lcd_bar_glyphs) / sizeof(_lcd_bar_glyphs[0]))
+
+static byte_t _lcd_bar_chars[LCD_BAR_CELL_STEPS * 2] = {' '}; // Symbols by the lit columns: 0-5 from the left, then 1-4 from the right
+
+bool lcd_bar_init(__LCD_MULTIMODE_ONLY_INFO_ARG(info)) {
+	for (uint8_t i = 0; i < __BAR_GLYPH_COUNT; i++) {
+		#if LCD_HD44780_PIN_GLYPH_CACHE
+			const byte_t ch = lcd_glyph_pin(_lcd_bar_glyphs[i]);
+			if (ch == LCD_GLYPH_NONE) {
+				while (i) {
+					lcd_glyph_unpin(_lcd_bar_glyphs[--i]); // The slots are given back to the other users
+				}
+				return false;
+			}
+		#else
+		#	if LCD_BAR_CENTER_ZERO
+			const byte_t ch = i;
+		#	else
+			const byte_t ch = LCD_BAR_FIRST_SLOT + i;
+		#	endif
+			byte_t rows[8];
+			for (uint8_t r = 0; r < 8; r++) {
+				rows[r] = _lcd_bar_glyphs[i][r];
+			}
+			lcd_custom_char(__LCD_MULTIMODE_ONLY_VAR_WITH_COMMA(info) ch, rows);
+		#endif
+		#if LCD_BAR_CENTER_ZERO
+			_lcd_bar_chars[(i < 4) ? (i + 1) : (i + 2)] = ch;
+		#else
+			_lcd_bar_chars[i + 1] = ch;
+		#endif
+	}
+	#if LCD_BAR_CENTER_ZERO
+		_lcd_bar_chars[LCD_BAR_CELL_STEPS] = LCD_BAR_FULL_CHAR;
+	#endif
+	return true;
+}
+
+// The bar grows to the right from the origin cell, the negative levels grow to the left from the cell before it
+static byte_t _lcd_bar_cell(const int16_t level, const uint8_t origin, const uint8_t i) {
+	int16_t lit;
+	if (i >= origin) {
+		lit = level - (int16_t)(i - origin) * LCD_BAR_CELL_STEPS;
+		if (lit <= 0) {
+			return _lcd_bar_chars[0];
+		}
+		return _lcd_bar_chars[(lit > LCD_BAR_CELL_STEPS) ? LCD_BAR_CELL_STEPS : lit];
+	}
+	lit = -level - (int16_t)(origin - 1 - i) * LCD_BAR_CELL_STEPS;
+	if (lit <= 0) {
+		return _lcd_bar_chars[0];
+	}
+	return _lcd_bar_chars[(lit >= LCD_BAR_CELL_STEPS) ? LCD_BAR_CELL_STEPS : (LCD_BAR_CELL_STEPS + lit)];
+}
+
+static void _lcd_bar_draw(__LCD_MULTIMODE_ONLY_INFO_ARG_WITH_COMMA(info) lcd_bar_t *const bar, const int16_t level, const uint8_t origin) {
+	if (bar->valid && (level == bar->level)) {
+		return;
+	}
+	bool run = false;
+	for (uint8_t i = 0; i < bar->width; i++) {
+		const byte_t ch = _lcd_bar_cell(level, origin, i);
+		if (bar->valid && (ch == _lcd_bar_cell(bar->level, origin, i))) {
+			run = false;
+			continue;
+		}
+		if (!run) {
+			lcd_set_pos(__LCD_MULTIMODE_ONLY_VAR_WITH_COMMA(info) (lcd_line_t)bar->row, bar->col + i);
+			run = true;
+		}
+		lcd_byte(__LCD_MULTIMODE_ONLY_VAR_WITH_COMMA(info) ch);
+	}
+	bar->level = level;
+	bar->valid = true;
+}
+
+static int16_t _lcd_bar_level(const uint16_t value, const uint16_t max, const uint8_t cells) {
+	const uint16_t steps = (uint16_t)cells * LCD_BAR_CELL_STEPS;
+	if (value >= max) {
+		return steps;
+	}
+	return (uint32_t)value * steps / max;
+}
+
+void lcd_bar(__LCD_MULTIMODE_ONLY_INFO_ARG_WITH_COMMA(info) lcd_bar_t *const bar, const uint16_t value, const uint16_t max) {
+	_lcd_bar_draw(__LCD_MULTIMODE_ONLY_VAR_WITH_COMMA(info) bar, _lcd_bar_level(value, max, bar->width), 0);
+}
+
+#if LCD_BAR_CENTER_ZERO
+void lcd_bar_center(__LCD_MULTIMODE_ONLY_INFO_ARG_WITH_COMMA(info) lcd_bar_t *const bar, const int16_t value, const uint16_t max) {
+	const uint8_t half = bar->width / 2;
+	if (value < 0) {
+		_lcd_bar_draw(__LCD_MULTIMODE_ONLY_VAR_WITH_COMMA(info) bar, -_lcd_bar_level(-(int32_t)value, max, half), half);
+	} else {
+		_lcd_bar_draw(__LCD_MULTIMODE_ONLY_VAR_WITH_COMMA(info) bar, _lcd_bar_level(value, max, half), half);
+	}
+}
+#endif // LCD_BAR_CENTER_ZERO
+
+void lcd_bar_invalidate(lcd_bar_t *const bar) {
+	bar->valid = false;
+}
@@ -0,0 +1,220 @@
+// ---------------------------------------------------------------------------+
+//					This file is part of SLS AVR Library
+//				https://github.com/SimonLitt/sls-avr-lib
+// ---------------------------------------------------------------------------+
+// Copyright (C) 2025 Simon Litt <simon@1itt.net> https://coding.1itt.net,
+// 												  https://github.com/SimonLitt
+//
+// This program is free software: you can redistribute it and/or modify it
+// under the terms of the GNU General Public License as published by the Free
+// Software Foundation, version 3.
+//
+// This program is distributed in the hope that it will be useful, but WITHOUT
+// ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+// FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License for
+// more details.
+//
+// You should have received a copy of the GNU General Public License along
+// with this program. If not, see <https://www.gnu.org/licenses/>.
+// ---------------------------------------------------------------------------+
+#include <sls-avr/lcd_big.h>
+
+// Seven segments
+#define __SEG_A					0x01
+#define __SEG_B					0x02
+#define __SEG_C					0x04
+#define __SEG_D					0x08
+#define __SEG_E					0x10
+#define __SEG_F					0x20
+#define __SEG_G					0x40
+
+#define __BIG_MINUS				10
+#define __BIG_BLANK				11
+
+static const __flash byte_t _lcd_big_segments[] = {
+	__SEG_A | __SEG_B | __SEG_C | __SEG_D | __SEG_E | __SEG_F,
+	__SEG_B | __SEG_C,
+	__SEG_A | __SEG_B | __SEG_D | __SEG_E | __SEG_G,
+	__SEG_A | __SEG_B | __SEG_C | __SEG_D | __SEG_G,
+	__SEG_B | __SEG_C | __SEG_F | __SEG_G,
+	__SEG_A | __SEG_C | __SEG_D | __SEG_F | __SEG_G,
+	__SEG_A | __SEG_C | __SEG_D | __SEG_E | __SEG_F | __SEG_G,
+	__SEG_A | __SEG_B | __SEG_C,
+	__SEG_A | __SEG_B | __SEG_C | __SEG_D | __SEG_E | __SEG_F | __SEG_G,
+	__SEG_A | __SEG_B | __SEG_C | __SEG_D | __SEG_F | __SEG_G,
+	__SEG_G, // __BIG_MINUS
+	0, // __BIG_BLANK
+};
+
+// Custom symbols
+#define __BIG_FULL				0
+#define __BIG_TOP				1
+#define __BIG_BOTTOM			2
+#if LCD_BIG_DIGIT_ROWS == 2
+#	define __BIG_TOP_BOTTOM		3
+#	define __BIG_GLYPH_COUNT	4
+#else
+#	define __BIG_MIDDLE			3
+#	define __BIG_UPPER			4
+#	define __BIG_LOWER			5
+#	define __BIG_GLYPH_COUNT	6
+#endif
+
+static const __flash byte_t _lcd_big_glyphs[__BIG_GLYPH_COUNT][8] = {
+	{0x1F, 0x1F, 0x1F, 0x1F, 0x1F, 0x1F, 0x1F, 0x1F},
+	{0x1F, 0x1F, 0x1F, 0x00, 0x00, 0x00, 0x00, 0x00},
+	{0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0x1F, 0x1F},
+#if LCD_BIG_DIGIT_ROWS == 2
+	{0x1F, 0x1F, 0x1F, 0x00, 0x00, 0x1F, 0x1F, 0x1F},
+#else
+	{0x00, 0x00, 0x00, 0x1F, 0x1F, 0x00, 0x00, 0x00},
+	{0x1F, 0x1F, 0x1F, 0x1F, 0x00, 0x00, 0x00, 0x00},
+	{0x00, 0x00, 0x00, 0x00, 0x1F, 0x1F, 0x1F, 0x1F},
+#endif
+};
+
+static byte_t _lcd_big_chars[__BIG_GLYPH_COUNT]; // Symbol codes of the custom symbols
+
+bool lcd_big_init(__LCD_MULTIMODE_ONLY_INFO_ARG(info)) {
+	for (uint8_t i = 0; i < __BIG_GLYPH_COUNT; i++) {
+		#if LCD_HD44780_PIN_GLYPH_CACHE
+			_lcd_big_chars[i] = lcd_glyph_pin(_lcd_big_glyphs[i]);
+			if (_lcd_big_chars[i] == LCD_GLYPH_NONE) {
+				while (i) {
+					lcd_glyph_unpin(_lcd_big_glyphs[--i]); // The slots are given back to the other users
+				}
+				return false;
+			}
+		#else
+			byte_t rows[8];
+			for (uint8_t r = 0; r < 8; r++) {
+				rows[r] = _lcd_big_glyphs[i][r];
+			}
+			_lcd_big_chars[i] = LCD_BIG_FIRST_SLOT + i;
+			lcd_custom_char(__LCD_MULTIMODE_ONLY_VAR_WITH_COMMA(info) LCD_BIG_FIRST_SLOT + i, rows);
+		#endif
+	}
+	return true;
+}
+
+#define __BIG_IS(_s)			((seg & (_s)) != 0)
+#define __BIG_CHAR(_g)			_lcd_big_chars[(_g)]
+
+// The symbol of a digit cell, the side columns take the vertical segments and the middle one only the horizontal ones
+static byte_t _lcd_big_cell(const byte_t seg, const uint8_t row, const uint8_t col) {
+	const byte_t side = (col == 0) ? __SEG_F : ((col == 2) ? __SEG_B : 0); // The upper vertical segment of the column
+	const byte_t side_low = (col == 0) ? __SEG_E : ((col == 2) ? __SEG_C : 0);
+	#if LCD_BIG_DIGIT_ROWS == 2
+	if (row == 0) {
+		if (__BIG_IS(side)) {
+			return __BIG_CHAR(__BIG_FULL);
+		}
+		if (__BIG_IS(__SEG_A)) {
+			return __BIG_CHAR(__BIG_IS(__SEG_G) ? __BIG_TOP_BOTTOM : __BIG_TOP);
+		}
+		return __BIG_IS(__SEG_G) ? __BIG_CHAR(__BIG_BOTTOM) : ' ';
+	}
+	#else
+	if (row == 0) {
+		if (__BIG_IS(side)) {
+			return __BIG_CHAR(__BIG_FULL);
+		}
+		return __BIG_IS(__SEG_A) ? __BIG_CHAR(__BIG_TOP) : ' ';
+	}
+	if (row == 1) {
+		if (__BIG_IS(side) && __BIG_IS(side_low)) {
+			return __BIG_CHAR(__BIG_FULL);
+		}
+		if (__BIG_IS(side)) {
+			return __BIG_CHAR(__BIG_UPPER);
+		}
+		if (__BIG_IS(side_low)) {
+			return __BIG_CHAR(__BIG_LOWER);
+		}
+		return __BIG_IS(__SEG_G) ? __BIG_CHAR(__BIG_MIDDLE) : ' ';
+	}
+	#endif
+	if (__BIG_IS(side_low)) {
+		return __BIG_CHAR(__BIG_FULL);
+	}
+	return __BIG_IS(__SEG_D) ? __BIG_CHAR(__BIG_BOTTOM) : ' ';
+}
+
+static void _lcd_big_draw(__LCD_MULTIMODE_ONLY_INFO_ARG_WITH_COMMA(info) const uint8_t row, const uint8_t col, const byte_t sym, const bool with_gap) {
+	const byte_t seg = _lcd_big_segments[sym];
+	for (uint8_t r = 0; r < LCD_BIG_DIGIT_ROWS; r++) {
+		lcd_set_pos(__LCD_MULTIMODE_ONLY_VAR_WITH_COMMA(info) (lcd_line_t)(row + r), col);
+		for (uint8_t c = 0; c < 3; c++) {
+			lcd_byte(__LCD_MULTIMODE_ONLY_VAR_WITH_COMMA(info) _lcd_big_cell(seg, r, c));
+		}
+		if (with_gap) {
+			lcd_byte(__LCD_MULTIMODE_ONLY_VAR_WITH_COMMA(info) ' ');
+		}
+	}
+}
+
+static void _lcd_big_point(__LCD_MULTIMODE_ONLY_INFO_ARG_WITH_COMMA(info) const uint8_t row, const uint8_t col) {
+	lcd_set_pos(__LCD_MULTIMODE_ONLY_VAR_WITH_COMMA(info) (lcd_line_t)(row + LCD_BIG_DIGIT_ROWS - 1), col);
+	lcd_byte(__LCD_MULTIMODE_ONLY_VAR_WITH_COMMA(info) '.');
+}
+
+static void _lcd_big_number(__LCD_MULTIMODE_ONLY_INFO_ARG_WITH_COMMA(info) lcd_big_t *const big, uint32_t value, const bool neg, uint8_t frac_digits, uint8_t digits) {
+	if (!digits) {
+		return;
+	}
+	if (digits > LCD_BIG_MAX_DIGITS) {
+		digits = LCD_BIG_MAX_DIGITS;
+	}
+	if (frac_digits >= digits) {
+		frac_digits = digits - 1; // An integer digit is kept before the point
+	}
+	byte_t sym[LCD_BIG_MAX_DIGITS];
+	uint8_t pos = digits;
+	do {
+		pos--;
+		sym[pos] = value % 10;
+		value /= 10;
+	} while (pos && (value || ((uint8_t)(digits - pos) <= frac_digits))); // A leading zero before the point
+	bool overflow = value != 0;
+	if (neg) {
+		if (pos) {
+			sym[--pos] = __BIG_MINUS;
+		} else {
+			overflow = true;
+		}
+	}
+	while (pos) {
+		sym[--pos] = __BIG_BLANK;
+	}
+	if (overflow) {
+		for (pos = 0; pos < digits; pos++) {
+			sym[pos] = __BIG_MINUS;
+		}
+	}
+
+	uint8_t col = big->col;
+	for (pos = 0; pos < digits; pos++) {
+		if (!big->valid || (big->shown[pos] != sym[pos])) {
+			_lcd_big_draw(__LCD_MULTIMODE_ONLY_VAR_WITH_COMMA(info) big->row, col, sym[pos], !big->valid);
+			big->shown[pos] = sym[pos];
+		}
+		if (!big->valid && frac_digits && (pos == digits - frac_digits - 1)) {
+			_lcd_big_point(__LCD_MULTIMODE_ONLY_VAR_WITH_COMMA(info) big->row, col + LCD_BIG_DIGIT_PITCH - 1); // In the blank column of the last integer digit
+		}
+		col += LCD_BIG_DIGIT_PITCH;
+	}
+	big->valid = true;
+}
+
+void lcd_big_u16(__LCD_MULTIMODE_ONLY_INFO_ARG_WITH_COMMA(info) lcd_big_t *const big, const uint16_t value, const uint8_t digits) {
+	_lcd_big_number(__LCD_MULTIMODE_ONLY_VAR_WITH_COMMA(info) big, value, false, 0, digits);
+}
+
+void lcd_big_fixed(__LCD_MULTIMODE_ONLY_INFO_ARG_WITH_COMMA(info) lcd_big_t *const big, const int32_t value, const uint8_t frac_digits, const uint8_t digits) {
+	const bool neg = value < 0;
+	_lcd_big_number(__LCD_MULTIMODE_ONLY_VAR_WITH_COMMA(info) big, neg ? -(uint32_t)value : (uint32_t)value, neg, frac_digits, digits);
+}
+
+void lcd_big_invalidate(lcd_big_t *const big) {
+	big->valid = false;
+}
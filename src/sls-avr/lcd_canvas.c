@@ -0,0 +1,115 @@
+// ---------------------------------------------------------------------------+
+//					This file is part of SLS AVR Library
+//				https://github.com/SimonLitt/sls-avr-lib
+// ---------------------------------------------------------------------------+
+// Copyright (C) 2025 Simon Litt <simon@1itt.net> https://coding.1itt.net,
+// 												  https://github.com/SimonLitt
+//
+// This program is free software: you can redistribute it and/or modify it
+// under the terms of the GNU General Public License as published by the Free
+// Software Foundation, version 3.
+//
+// This program is distributed in the hope that it will be useful, but WITHOUT
+// ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+// FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License for
+// more details.
+//
+// You should have received a copy of the GNU General Public License along
+// with this program. If not, see <https://www.gnu.org/licenses/>.
+// ---------------------------------------------------------------------------+
+#include <sls-avr/lcd_canvas.h>
+#include <stdlib.h>
+#include <string.h>
+
+void lcd_canvas_init(lcd_canvas_t *const canvas) {
+	memset(canvas->bits, 0, sizeof(canvas->bits));
+	lcd_canvas_invalidate(canvas);
+}
+
+void lcd_canvas_place(__LCD_MULTIMODE_ONLY_INFO_ARG_WITH_COMMA(info) const lcd_line_t line, const uint8_t pos) {
+	byte_t ch = LCD_CANVAS_FIRST_SLOT;
+	for (uint8_t row = 0; row < LCD_CANVAS_ROWS; row++) {
+		lcd_set_pos(__LCD_MULTIMODE_ONLY_VAR_WITH_COMMA(info) (lcd_line_t)(line + row), pos);
+		for (uint8_t col = 0; col < LCD_CANVAS_COLS; col++) {
+			lcd_byte(__LCD_MULTIMODE_ONLY_VAR_WITH_COMMA(info) ch++);
+		}
+	}
+}
+
+void lcd_canvas_clear(lcd_canvas_t *const canvas) {
+	for (uint8_t cell = 0; cell < LCD_CANVAS_CELLS; cell++) {
+		for (uint8_t row = 0; row < 8; row++) {
+			if (canvas->bits[cell][row]) {
+				canvas->bits[cell][row] = 0;
+				canvas->dirty[cell] |= _BV(row);
+			}
+		}
+	}
+}
+
+void lcd_canvas_set_pixel(lcd_canvas_t *const canvas, const uint8_t x, const uint8_t y, const bool on) {
+	if ((x >= LCD_CANVAS_WIDTH) || (y >= LCD_CANVAS_HEIGHT)) {
+		return;
+	}
+	const uint8_t cell = (y / 8) * LCD_CANVAS_COLS + x / 5;
+	const uint8_t row = y % 8;
+	const byte_t mask = 0x10 >> (x % 5); // The left pixel is the bit 4
+	const byte_t bits = on ? (canvas->bits[cell][row] | mask) : (canvas->bits[cell][row] & ~mask);
+	if (bits != canvas->bits[cell][row]) {
+		canvas->bits[cell][row] = bits;
+		canvas->dirty[cell] |= _BV(row);
+	}
+}
+
+void lcd_canvas_line(lcd_canvas_t *const canvas, const uint8_t x0, const uint8_t y0, const uint8_t x1, const uint8_t y1, const bool on) {
+	// Bresenham's algorithm
+	const int16_t dx = abs((int16_t)x1 - x0);
+	const int16_t dy = -abs((int16_t)y1 - y0);
+	const int8_t sx = (x0 < x1) ? 1 : -1;
+	const int8_t sy = (y0 < y1) ? 1 : -1;
+	int16_t err = dx + dy;
+	uint8_t x = x0;
+	uint8_t y = y0;
+	while (1) {
+		lcd_canvas_set_pixel(canvas, x, y, on);
+		if ((x == x1) && (y == y1)) {
+			break;
+		}
+		const int16_t e2 = 2 * err;
+		if (e2 >= dy) {
+			err += dy;
+			x += sx;
+		}
+		if (e2 <= dx) {
+			err += dx;
+			y += sy;
+		}
+	}
+}
+
+void lcd_canvas_flush(__LCD_MULTIMODE_ONLY_INFO_ARG_WITH_COMMA(info) lcd_canvas_t *const canvas) {
+	bool run = false; // The address counter points to the next row, the slots follow each other in CGRAM
+	for (uint8_t cell = 0; cell < LCD_CANVAS_CELLS; cell++) {
+		const byte_t dirty = canvas->dirty[cell];
+		if (!dirty) {
+			run = false;
+			continue;
+		}
+		for (uint8_t row = 0; row < 8; row++) {
+			if (flag_is_clear(dirty, row)) {
+				run = false;
+				continue;
+			}
+			if (!run) {
+				lcd_cgr_adr(__LCD_MULTIMODE_ONLY_VAR_WITH_COMMA(info) (LCD_CANVAS_FIRST_SLOT + cell) * 8 + row);
+				run = true;
+			}
+			lcd_byte(__LCD_MULTIMODE_ONLY_VAR_WITH_COMMA(info) canvas->bits[cell][row]);
+		}
+		canvas->dirty[cell] = 0;
+	}
+}
+
+void lcd_canvas_invalidate(lcd_canvas_t *const canvas) {
+	memset(canvas->dirty, 0xFF, sizeof(canvas->dirty));
+}
@@ -0,0 +1,102 @@
+// ---------------------------------------------------------------------------+
+//					This file is part of SLS AVR Library
+//				https://github.com/SimonLitt/sls-avr-lib
+// ---------------------------------------------------------------------------+
+// Copyright (C) 2025 Simon Litt <simon@1itt.net> https://coding.1itt.net,
+// 												  https://github.com/SimonLitt
+//
+// This program is free software: you can redistribute it and/or modify it
+// under the terms of the GNU General Public License as published by the Free
+// Software Foundation, version 3.
+//
+// This program is distributed in the hope that it will be useful, but WITHOUT
+// ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+// FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License for
+// more details.
+//
+// You should have received a copy of the GNU General Public License along
+// with this program. If not, see <https://www.gnu.org/licenses/>.
+// ---------------------------------------------------------------------------+
+#include <sls-avr/lcd_dashboard.h>
+#include <avr/pgmspace.h>
+#include <util/atomic.h>
+
+static uint32_t _lcd_field_read(const __flash lcd_field_t *const field) {
+	uint32_t value;
+	#if LCD_DASHBOARD_ATOMIC
+	ATOMIC_BLOCK(ATOMIC_RESTORESTATE)
+	#endif
+	{
+		switch (field->type) {
+			case LCD_FIELD_U8:
+				value = *(const volatile uint8_t *)field->var;
+				break;
+			case LCD_FIELD_U16:
+				value = *(const volatile uint16_t *)field->var;
+				break;
+			case LCD_FIELD_I16:
+				value = (uint32_t)(int32_t)*(const volatile int16_t *)field->var;
+				break;
+			case LCD_FIELD_STR_P:
+				value = (uintptr_t)*(const char *const volatile *)field->var; // Only the address is compared
+				break;
+			default:
+				value = *(const volatile uint32_t *)field->var;
+				break;
+		}
+	}
+	return value;
+}
+
+static void _lcd_field_draw(__LCD_MULTIMODE_ONLY_INFO_ARG_WITH_COMMA(info) const __flash lcd_field_t *const field, const uint32_t value) {
+	lcd_set_pos(__LCD_MULTIMODE_ONLY_VAR_WITH_COMMA(info) field->row, field->col);
+	switch (field->type) {
+		case LCD_FIELD_STR_P: {
+			const char *str = (const char *)(uintptr_t)value;
+			uint8_t pos = 0;
+			for (char ch; (pos < field->width) && ((ch = pgm_read_byte(str + pos)) != '\0'); pos++) {
+				lcd_byte(__LCD_MULTIMODE_ONLY_VAR_WITH_COMMA(info) ch);
+			}
+			for (; pos < field->width; pos++) {
+				lcd_byte(__LCD_MULTIMODE_ONLY_VAR_WITH_COMMA(info) ' '); // Clears the rest of a longer previous string
+			}
+			break;
+		}
+		case LCD_FIELD_U8:
+		case LCD_FIELD_U16:
+		case LCD_FIELD_U32:
+			if (!field->frac_digits) {
+				lcd_put_u32(__LCD_MULTIMODE_ONLY_VAR_WITH_COMMA(info) value, field->width, field->pad);
+				break;
+			}
+			// fall through
+		default:
+			lcd_put_fixed(__LCD_MULTIMODE_ONLY_VAR_WITH_COMMA(info) (int32_t)value, field->frac_digits, field->width, field->pad);
+			break;
+	}
+}
+
+void lcd_dashboard_poll(__LCD_MULTIMODE_ONLY_INFO_ARG_WITH_COMMA(info) const __flash lcd_field_t fields[], lcd_field_state_t state[], const uint8_t count, const uint16_t now) {
+	for (uint8_t i = 0; i < count; i++) {
+		const __flash lcd_field_t *const field = &fields[i];
+		const uint32_t value = _lcd_field_read(field);
+		if (state[i].valid) {
+			if (value == state[i].last) {
+				continue;
+			}
+			if ((uint16_t)(now - state[i].stamp) < field->min_ticks) {
+				continue; // Drawn on a later call, the change is still there
+			}
+		}
+		_lcd_field_draw(__LCD_MULTIMODE_ONLY_VAR_WITH_COMMA(info) field, value);
+		state[i].last = value;
+		state[i].stamp = now;
+		state[i].valid = true;
+	}
+}
+
+void lcd_dashboard_invalidate(lcd_field_state_t state[], const uint8_t count) {
+	for (uint8_t i = 0; i < count; i++) {
+		state[i].valid = false;
+	}
+}
@@ -18,32 +18,67 @@
 // with this program. If not, see <https://www.gnu.org/licenses/>.
 // ---------------------------------------------------------------------------+
 #include <sls-avr/lcd_hd44780_pin.h>
+#include <string.h>
+#include <avr/pgmspace.h>
 #include <util/delay.h>
 
 #if LCD_HD44780_PIN_MULTI_MODE
-#	define __LCD_MULTIMODE_ONLY_VAR(_n)						(_ ## _n)
-#	define __LCD_MULTIMODE_ONLY_VAR_BY_REF(_n)				&__LCD_MULTIMODE_ONLY_VAR(_n)
-#	define __LCD_MULTIMODE_ONLY_VAR_WITH_COMMA(_n)			__LCD_MULTIMODE_ONLY_VAR(_n),
-#	define __LCD_MULTIMODE_ONLY_VAR_BY_REF_WITH_COMMA(_n)	&__LCD_MULTIMODE_ONLY_VAR_WITH_COMMA(_n)
-
 #	define __LCD_MULTIMODE_ONLY_BOOL_ARG(_n)				const bool _ ## _n
 
+// The display functions are generic ones here, the public API wraps them at the end of the file.
+// A descriptor is never changed after lcd_init(), so it is read as not volatile. For the constant
+// descriptors of LCD_HD44780_PIN_INSTANCES all the fields are folded into SBI/CBI and immediate values.
+// With LCD_HD44780_PIN_FLASH_INFO the descriptor fields are read from flash by LPM.
+#	undef __LCD_MULTIMODE_ONLY_INFO_ARG
+#	define __LCD_MULTIMODE_ONLY_INFO_ARG(_n)				const __LCD_INFO_SPACE lcd_info_struct *const _ ## _n
+#	ifdef LCD_HD44780_PIN_INSTANCES
+#		define __LCD_STATIC								static inline __attribute__((always_inline))
+#	else
+#		define __LCD_STATIC								static inline
+#	endif
+#	define __LCD_API									__LCD_STATIC
+
+#	define lcd_clear						_lcd_g_clear
+#	define lcd_home							_lcd_g_home
+#	define lcd_entry_mode					_lcd_g_entry_mode
+#	define lcd_display_ctrl					_lcd_g_display_ctrl
+#	define lcd_cursor						_lcd_g_cursor
+#	define lcd_func_set						_lcd_g_func_set
+#	define lcd_cgr_adr						_lcd_g_cgr_adr
+#	define lcd_ddr_adr						_lcd_g_ddr_adr
+#	define lcd_set_pos						_lcd_g_set_pos
+#	define lcd_byte							_lcd_g_byte
+#	define lcd_line							_lcd_g_line
+#	define lcd_print						_lcd_g_print
+#	define lcd_refresh_ml					_lcd_g_refresh_ml
+#	define lcd_write_block					_lcd_g_write_block
+#	define lcd_write_at						_lcd_g_write_at
+#	define lcd_line_P						_lcd_g_line_P
+#	define lcd_print_P						_lcd_g_print_P
+#	define lcd_refresh_ml_P					_lcd_g_refresh_ml_P
+#	define lcd_write_block_P				_lcd_g_write_block_P
+#	define lcd_put_u16						_lcd_g_put_u16
+#	define lcd_put_u32						_lcd_g_put_u32
+#	define lcd_put_i32						_lcd_g_put_i32
+#	define lcd_put_fixed					_lcd_g_put_fixed
+#	define lcd_custom_char					_lcd_g_custom_char
+#	define lcd_load_glyph_set				_lcd_g_load_glyph_set
+#	define lcd_read_busy_and_addr			_lcd_g_read_busy_and_addr
+#	define lcd_read_data					_lcd_g_read_data
+
 #	define __INFO_ROW_COUT				_info->row_cout
 #	define __INFO_COL_COUT				_info->col_cout
-#	define __INFO_ROW_1_ADDR			_info->row_1_addr
-#	define __INFO_ROW_2_ADDR			_info->row_2_addr
-#	define __INFO_ROW_3_ADDR			_info->row_3_addr
-#	define __INFO_ROW_4_ADDR			_info->row_4_addr
+#	define __INFO_ROW_1_ADDR			_info->row_addr[LCD_ROW_1]
 
 #else
-#	define __LCD_MULTIMODE_ONLY_VAR(_n)
-#	define __LCD_MULTIMODE_ONLY_VAR_BY_REF(_n)
-#	define __LCD_MULTIMODE_ONLY_VAR_WITH_COMMA(_n)
-#	define __LCD_MULTIMODE_ONLY_VAR_BY_REF_WITH_COMMA(_n)
-
 #	define __LCD_MULTIMODE_ONLY_BOOL_ARG(_n)				void
 
-#	if !LCD_HD44780_PIN_IDL_8BIT
+#	define __LCD_STATIC								static
+#	define __LCD_API
+
+#	if LCD_HD44780_PIN_DUAL_NIBBLE
+#		define __INFO_PORT_MASK			0xFFU // Both nibbles, one for each display of the pair
+#	elif !LCD_HD44780_PIN_IDL_8BIT
 #		define __INFO_DATA_SHIFT		LCD_HD44780_PIN_DATA_FIRST_PIN
 #		define __INFO_PORT_MASK			(_HD44780_HALF_DATA_MASK << LCD_HD44780_PIN_DATA_FIRST_PIN)
 #	else
@@ -95,8 +130,7 @@
 #	elif (LCD_HD44780_PIN_DISPLAY_TYPE == HD44780_DISPLAY_40X4)
 #		define __INFO_ROW_COUT			4
 #		define __INFO_COL_COUT			40
-#		error "Display 40x4 currently unsupported!"
-#		error "TODO: Implement: Two E chanels!"
+#		define __LCD_DUAL_E				1 // Two 40x2 controllers, the rows 3 and 4 are selected by E2
 #		define __INFO_ROW_1_ADDR		HD44780_ROW_1_DDRAM_ADR
 #		define __INFO_ROW_2_ADDR		HD44780_ROW_2_DDRAM_ADR
 #		define __INFO_ROW_3_ADDR		HD44780_ROW_1_DDRAM_ADR
@@ -106,31 +140,115 @@
 #	endif
 #endif
 
-static void _lcd_send(__LCD_MULTIMODE_ONLY_INFO_ARG_WITH_COMMA(info) const byte_t ch) {
+#ifndef __LCD_DUAL_E
+#	define __LCD_DUAL_E					0
+#endif
+
+#if __LCD_DUAL_E
+#	define __LCD_E1						0x01 // The controller of the rows 1 and 2
+#	define __LCD_E2						0x02 // The controller of the rows 3 and 4
+#	define __LCD_E_BOTH					(__LCD_E1 | __LCD_E2)
+#	define __LCD_E_READ					((_lcd_e == __LCD_E_BOTH) ? __LCD_E1 : _lcd_e) // Only one controller can drive the bus
+#	define __LCD_E_ON()					do { \
+											if (_lcd_bus & __LCD_E1) { PIN_ON(LCD_HD44780_PIN_E_PORT, LCD_HD44780_PIN_E_PIN); } \
+											if (_lcd_bus & __LCD_E2) { PIN_ON(LCD_HD44780_PIN_E2_PORT, LCD_HD44780_PIN_E2_PIN); } \
+										} while (0)
+#	define __LCD_E_OFF()				do { \
+											if (_lcd_bus & __LCD_E1) { PIN_OFF(LCD_HD44780_PIN_E_PORT, LCD_HD44780_PIN_E_PIN); } \
+											if (_lcd_bus & __LCD_E2) { PIN_OFF(LCD_HD44780_PIN_E2_PORT, LCD_HD44780_PIN_E2_PIN); } \
+										} while (0)
+
+static byte_t _lcd_e = __LCD_E1; // Controllers of the next data, both for CGRAM
+static byte_t _lcd_bus = __LCD_E_BOTH; // Controllers of the next E pulse
+static byte_t _lcd_disp; // Display control flags, the cursor is shown only by the controller of _lcd_e
+
+#	if LCD_HD44780_PIN_ALLOW_RW
+static byte_t _lcd_read_busy_and_addr(void);
+#	endif
+#else
+#	define __LCD_E_ON()					PIN_ON(LCD_HD44780_PIN_E_PORT, LCD_HD44780_PIN_E_PIN)
+#	define __LCD_E_OFF()				PIN_OFF(LCD_HD44780_PIN_E_PORT, LCD_HD44780_PIN_E_PIN)
+#endif
+
+#if LCD_HD44780_PIN_MULTI_MODE
+// The header declares only the public wrappers
+__LCD_API void lcd_clear(__LCD_MULTIMODE_ONLY_INFO_ARG(info));
+__LCD_API void lcd_entry_mode(__LCD_MULTIMODE_ONLY_INFO_ARG_WITH_COMMA(info) const uint8_t flags);
+__LCD_API void lcd_display_ctrl(__LCD_MULTIMODE_ONLY_INFO_ARG_WITH_COMMA(info) const uint8_t flags);
+__LCD_API void lcd_func_set(__LCD_MULTIMODE_ONLY_INFO_ARG_WITH_COMMA(info) const uint8_t flags);
+__LCD_API void lcd_cgr_adr(__LCD_MULTIMODE_ONLY_INFO_ARG_WITH_COMMA(info) const uint8_t flags);
+__LCD_API void lcd_ddr_adr(__LCD_MULTIMODE_ONLY_INFO_ARG_WITH_COMMA(info) const uint8_t flags);
+__LCD_API void lcd_byte(__LCD_MULTIMODE_ONLY_INFO_ARG_WITH_COMMA(info) const byte_t ch);
+__LCD_API byte_t lcd_read_busy_and_addr(__LCD_MULTIMODE_ONLY_INFO_ARG(info));
+#endif
+
+#if LCD_HD44780_PIN_BROADCAST
+static const lcd_bus_t *_lcd_broadcast = NULL; // All the E lines of the bus are raised while it's set
+
+// While broadcasting the controllers can't be read, they would drive the bus together
+#	define __LCD_INFO_CAN_READ(_i)		(flag_is_set((_i)->flags, __HD44780_CONF_READ_BIT) && !_lcd_broadcast)
+
+static void _lcd_broadcast_e(const bool on) {
+	for (uint8_t i = 0; i < _lcd_broadcast->count; i++) {
+		const __LCD_INFO_SPACE lcd_info_struct *const _info = (const __LCD_INFO_SPACE lcd_info_struct *)_lcd_broadcast->displays[i];
+		if (on) {
+			pin_on(*(_info->e_port), _info->e_pin);
+		} else {
+			pin_off(*(_info->e_port), _info->e_pin);
+		}
+	}
+}
+#elif LCD_HD44780_PIN_MULTI_MODE
+#	define __LCD_INFO_CAN_READ(_i)		flag_is_set((_i)->flags, __HD44780_CONF_READ_BIT)
+#endif
+
+#if LCD_HD44780_PIN_DUAL_NIBBLE
+// The low nibble of the port goes to the first display of the pair, the high nibble to the second one
+static void _lcd_pair_send(const byte_t nibbles) {
+	GPIO_SET(LCD_HD44780_PIN_DATA_PORT, nibbles);
+	__LCD_E_ON();
+	_delay_us(HD44780_ENABLE_PULSE_US);
+	__LCD_E_OFF();
+	_delay_us(HD44780_ENABLE_PULSE_US);
+}
+#endif
+
+__LCD_STATIC void _lcd_send(__LCD_MULTIMODE_ONLY_INFO_ARG_WITH_COMMA(info) const byte_t ch) {
 	#if LCD_HD44780_PIN_MULTI_MODE
 		if (flag_is_set(_info->flags, __HD44780_CONF_IDL_BIT)) {
 			gpio_set(*(_info->data_port), ch);
 		} else {
 			port_replace(*(_info->data_port), _info->port_mask, ch << _info->data_shift);
 		}
+	#	if LCD_HD44780_PIN_BROADCAST
+		if (_lcd_broadcast) {
+			_lcd_broadcast_e(true);
+			_delay_us(HD44780_ENABLE_PULSE_US);
+			_lcd_broadcast_e(false);
+			_delay_us(HD44780_ENABLE_PULSE_US);
+			return;
+		}
+	#	endif
 		pin_on(*(_info->e_port), _info->e_pin);
 		_delay_us(HD44780_ENABLE_PULSE_US);
 		pin_off(*(_info->e_port), _info->e_pin);
 		_delay_us(HD44780_ENABLE_PULSE_US);
+	#elif LCD_HD44780_PIN_DUAL_NIBBLE
+		_lcd_pair_send((ch & _HD44780_HALF_DATA_MASK) | (ch << 4)); // The same nibble to both displays
 	#else
 	#	if LCD_HD44780_PIN_IDL_8BIT
 			GPIO_SET(LCD_HD44780_PIN_DATA_PORT, ch);
 	#	else
 			PORT_REPLACE(LCD_HD44780_PIN_DATA_PORT, __INFO_PORT_MASK, ch << __INFO_DATA_SHIFT);
 	#	endif
-		PIN_ON(LCD_HD44780_PIN_E_PORT, LCD_HD44780_PIN_E_PIN);
+		__LCD_E_ON();
 		_delay_us(HD44780_ENABLE_PULSE_US);
-		PIN_OFF(LCD_HD44780_PIN_E_PORT, LCD_HD44780_PIN_E_PIN);
+		__LCD_E_OFF();
 		_delay_us(HD44780_ENABLE_PULSE_US);
 	#endif
 }
 
-static void _lcd_byte(__LCD_MULTIMODE_ONLY_INFO_ARG_WITH_COMMA(info) const byte_t ch) {
+__LCD_STATIC void _lcd_byte(__LCD_MULTIMODE_ONLY_INFO_ARG_WITH_COMMA(info) const byte_t ch) {
 	#if LCD_HD44780_PIN_MULTI_MODE
 		if (!flag_is_set(_info->flags, __HD44780_CONF_IDL_BIT)) {
 			_lcd_send(_info, ch >> 4);
@@ -143,61 +261,462 @@ static void _lcd_byte(__LCD_MULTIMODE_ONLY_INFO_ARG_WITH_COMMA(info) const byte_
 	_lcd_send(__LCD_MULTIMODE_ONLY_VAR_WITH_COMMA(info) ch);
 }
 
-void lcd_byte(__LCD_MULTIMODE_ONLY_INFO_ARG_WITH_COMMA(info) const byte_t ch) {
-	_lcd_byte(__LCD_MULTIMODE_ONLY_VAR_WITH_COMMA(info) ch);
+// Execution time kinds, see HD44780_CMD_EXEC_TIME_US and others
+#define __LCD_EXEC_CMD				0
+#define __LCD_EXEC_DATA				1
+#define __LCD_EXEC_CLEAR			2
+#define __LCD_EXEC_HOME				3
+#define __LCD_EXEC_IS_LONG(_e)		((_e) >= __LCD_EXEC_CLEAR)
+#define __LCD_EXEC_OF_LONG(_ch)		(((_ch) == _HD44780_CLEAR) ? __LCD_EXEC_CLEAR : __LCD_EXEC_HOME)
+
+#if LCD_HD44780_PIN_ASYNC
+#	define __LCD_QUEUE_DATA			0
+#	define __LCD_QUEUE_CMD			1
+#	define __LCD_QUEUE_LONG_CMD		2
+#	define __LCD_QUEUE_MASK			(LCD_HD44780_PIN_ASYNC_QUEUE_SIZE - 1)
+#	define __LCD_ASYNC_TICKS(_us)	(((_us) + LCD_HD44780_PIN_ASYNC_TICK_US - 1) / LCD_HD44780_PIN_ASYNC_TICK_US)
+
+#	if (LCD_HD44780_PIN_ASYNC_QUEUE_SIZE < 2) || (LCD_HD44780_PIN_ASYNC_QUEUE_SIZE > 128) || (LCD_HD44780_PIN_ASYNC_QUEUE_SIZE & __LCD_QUEUE_MASK)
+#		error "LCD_HD44780_PIN_ASYNC_QUEUE_SIZE should be a power of 2 in range 2-128!"
+#	endif
+
+typedef struct {
+	byte_t kind;
+	byte_t ch;
+} _lcd_queue_item_t;
+
+static volatile _lcd_queue_item_t _lcd_queue[LCD_HD44780_PIN_ASYNC_QUEUE_SIZE]; // Volatile keeps the item written before the head is moved
+static volatile uint8_t _lcd_queue_head; // Written by the main thread only
+static volatile uint8_t _lcd_queue_tail; // Written by lcd_async_proc() only
+static volatile uint8_t _lcd_queue_wait; // Ticks until the controller is free
+
+void lcd_async_proc(void) {
+	if (_lcd_queue_wait) {
+		if (--_lcd_queue_wait) {
+			return;
+		}
+	}
+	uint8_t tail = _lcd_queue_tail;
+	if (tail == _lcd_queue_head) {
+		return;
+	}
+	_lcd_queue_item_t item = _lcd_queue[tail];
+	if (item.kind != __LCD_QUEUE_DATA) {
+		PIN_OFF(LCD_HD44780_PIN_RS_PORT, LCD_HD44780_PIN_RS_PIN);
+	}
+	_lcd_byte(item.ch);
+	PIN_ON(LCD_HD44780_PIN_RS_PORT, LCD_HD44780_PIN_RS_PIN);// Default on - data
+	switch (item.kind) {
+		case __LCD_QUEUE_DATA:
+			_lcd_queue_wait = __LCD_ASYNC_TICKS(HD44780_DATA_EXEC_TIME_US);
+			break;
+		case __LCD_QUEUE_CMD:
+			_lcd_queue_wait = __LCD_ASYNC_TICKS(HD44780_CMD_EXEC_TIME_US);
+			break;
+		default:
+			_lcd_queue_wait = (__LCD_EXEC_OF_LONG(item.ch) == __LCD_EXEC_CLEAR) ? __LCD_ASYNC_TICKS(HD44780_CLEAR_EXEC_TIME_US) : __LCD_ASYNC_TICKS(HD44780_HOME_EXEC_TIME_US);
+			break;
+	}
+	_lcd_queue_tail = (tail + 1) & __LCD_QUEUE_MASK;
+}
+
+uint8_t lcd_queue_free(void) {
+	return (_lcd_queue_tail - _lcd_queue_head - 1) & __LCD_QUEUE_MASK;
+}
+
+static void _lcd_async_poll(void) {
+	if (bit_is_clear(SREG, SREG_I)) { // Nobody else will do it
+		_delay_us(LCD_HD44780_PIN_ASYNC_TICK_US);
+		lcd_async_proc();
+	}
+}
+
+void lcd_flush(void) {
+	while ((_lcd_queue_tail != _lcd_queue_head) || _lcd_queue_wait) {
+		_lcd_async_poll();
+	}
+}
+
+static void _lcd_queue_put(const byte_t kind, const byte_t ch) {
+	while (!lcd_queue_free()) {
+		_lcd_async_poll();
+	}
+	uint8_t head = _lcd_queue_head;
+	_lcd_queue[head].kind = kind;
+	_lcd_queue[head].ch = ch;
+	_lcd_queue_head = (head + 1) & __LCD_QUEUE_MASK;
+}
+
+static void _lcd_write(const byte_t ch) {
+	_lcd_queue_put(__LCD_QUEUE_DATA, ch);
+}
+
+static void _lcd_command(const byte_t ch) {
+	_lcd_queue_put(__LCD_QUEUE_CMD, ch);
+}
+
+static void _lcd_long_command(const byte_t ch) {
+	_lcd_queue_put(__LCD_QUEUE_LONG_CMD, ch);
+}
+#else
+/** \cond NO_DOC */
+#	define __LCD_TIMER_WAIT		(LCD_HD44780_PIN_CALIBRATE || (LCD_HD44780_PIN_DEFERRED_WAIT && !LCD_HD44780_PIN_ALLOW_RW))
+#	define __LCD_BF_DEFERRED	((LCD_HD44780_PIN_DEFERRED_WAIT || __LCD_DUAL_E) && LCD_HD44780_PIN_ALLOW_RW && !LCD_HD44780_PIN_CALIBRATE) // The halves of 40x4 are always waited independently
+#	define __LCD_WAIT_DEFERRED	(LCD_HD44780_PIN_DEFERRED_WAIT || __LCD_BF_DEFERRED)
+/** \endcond */
+
+#	if __LCD_BF_DEFERRED && __LCD_DUAL_E
+static byte_t _lcd_busy = 0; // Controllers whose busy flag should be polled before the next operation
+#	elif __LCD_BF_DEFERRED
+static bool _lcd_busy = false; // The busy flag should be polled before the next operation
+#	elif __LCD_TIMER_WAIT
+/** \cond NO_DOC */
+#		define __LCD_US_TO_TICKS(_us)	((uint16_t)(((uint32_t)(_us) * (LCD_HD44780_PIN_TIMER_HZ / 1000UL) + 999UL) / 1000UL))
+/** \endcond */
+
+// Unsigned difference with the start survives one counter overflow, unlike an absolute deadline.
+// A wait left pending for a whole counter period can't be told from a fresh one and costs at most one more execution time.
+static uint16_t _lcd_busy_since = 0;
+static uint16_t _lcd_busy_ticks = 0;
+#		if LCD_HD44780_PIN_CALIBRATE
+/** \cond NO_DOC */
+#			define __LCD_CAL_MAX(_us)		(__LCD_US_TO_TICKS(_us) + 1) // The wait can start a tick late in the counter
+/** \endcond */
+
+static uint16_t _lcd_exec_ticks = __LCD_CAL_MAX(HD44780_EXEC_TIME_US);
+static uint16_t _lcd_data_exec_ticks = __LCD_CAL_MAX(HD44780_EXEC_TIME_US);
+static uint16_t _lcd_long_exec_ticks = __LCD_CAL_MAX(HD44780_LONG_EXEC_TIME_US);
+static bool _lcd_calibrating = false; // Set by lcd_init(), the busy flag is timed instead of waiting
+
+static void _lcd_calibrate(const uint8_t exec) {
+	lcd_read_busy_and_addr();
+	uint16_t ticks = LCD_HD44780_PIN_TIMER() - _lcd_busy_since;
+	// The measurement and the wait can be each a tick short, and a slow timer would round the margin down to nothing
+	ticks += (uint16_t)(((uint32_t)ticks * LCD_HD44780_PIN_CALIBRATE_MARGIN + 99U) / 100U) + 2;
+	if (__LCD_EXEC_IS_LONG(exec)) {
+		_lcd_long_exec_ticks = ticks < __LCD_CAL_MAX(HD44780_LONG_EXEC_TIME_US) ? ticks : __LCD_CAL_MAX(HD44780_LONG_EXEC_TIME_US);
+	} else if (ticks > _lcd_exec_ticks) { // The longest of the init commands
+		_lcd_exec_ticks = ticks < __LCD_CAL_MAX(HD44780_EXEC_TIME_US) ? ticks : __LCD_CAL_MAX(HD44780_EXEC_TIME_US);
+		ticks = _lcd_exec_ticks + __LCD_US_TO_TICKS(HD44780_ADD_US); // The busy flag is cleared before the address counter is updated
+		_lcd_data_exec_ticks = ticks < __LCD_CAL_MAX(HD44780_EXEC_TIME_US) ? ticks : __LCD_CAL_MAX(HD44780_EXEC_TIME_US);
+	}
+}
+#		endif // LCD_HD44780_PIN_CALIBRATE
+#	endif
+
+#	if __LCD_BF_DEFERRED || __LCD_TIMER_WAIT
+static void _lcd_wait_ready(void) {
+	#if __LCD_BF_DEFERRED && __LCD_DUAL_E
+		const byte_t bus = _lcd_bus;
+		const byte_t busy = _lcd_busy & bus;
+		if (busy & __LCD_E1) {
+			_lcd_bus = __LCD_E1;
+			_lcd_read_busy_and_addr(); // Clears the bit of _lcd_busy
+		}
+		if (busy & __LCD_E2) {
+			_lcd_bus = __LCD_E2;
+			_lcd_read_busy_and_addr();
+		}
+		_lcd_bus = bus;
+	#elif __LCD_BF_DEFERRED
+		if (_lcd_busy) {
+			lcd_read_busy_and_addr(); // Clears _lcd_busy
+		}
+	#else
+		if (_lcd_busy_ticks) {
+			while ((uint16_t)(LCD_HD44780_PIN_TIMER() - _lcd_busy_since) < _lcd_busy_ticks) {}
+			_lcd_busy_ticks = 0;
+		}
+	#endif
+}
+#	endif
+
+#	if LCD_HD44780_PIN_MULTI_MODE || !(__LCD_BF_DEFERRED || LCD_HD44780_PIN_ALLOW_RW || __LCD_TIMER_WAIT)
+// Constant delays for _delay_us()
+static void _lcd_exec_delay(const uint8_t exec) {
+	switch (exec) {
+		case __LCD_EXEC_DATA:
+			_delay_us(HD44780_DATA_EXEC_TIME_US);
+			break;
+		case __LCD_EXEC_CLEAR:
+			_delay_us(HD44780_CLEAR_EXEC_TIME_US);
+			break;
+		case __LCD_EXEC_HOME:
+			_delay_us(HD44780_HOME_EXEC_TIME_US);
+			break;
+		default:
+			_delay_us(HD44780_CMD_EXEC_TIME_US);
+			break;
+	}
+}
+#	endif
+
+#	if __LCD_TIMER_WAIT && !LCD_HD44780_PIN_CALIBRATE
+static uint16_t _lcd_exec_ticks_of(const uint8_t exec) {
+	switch (exec) {
+		case __LCD_EXEC_DATA:
+			return __LCD_US_TO_TICKS(HD44780_DATA_EXEC_TIME_US);
+		case __LCD_EXEC_CLEAR:
+			return __LCD_US_TO_TICKS(HD44780_CLEAR_EXEC_TIME_US);
+		case __LCD_EXEC_HOME:
+			return __LCD_US_TO_TICKS(HD44780_HOME_EXEC_TIME_US);
+		default:
+			return __LCD_US_TO_TICKS(HD44780_CMD_EXEC_TIME_US);
+	}
+}
+#	endif
+
+// Waits for the execution of a just written byte, or only marks the controller as busy in the deferred wait mode
+__LCD_STATIC void _lcd_exec_wait(__LCD_MULTIMODE_ONLY_INFO_ARG_WITH_COMMA(info) const uint8_t exec) {
 	#if LCD_HD44780_PIN_MULTI_MODE
-		if (flag_is_set(_info->flags, __HD44780_CONF_READ_BIT)) {
+		if (__LCD_INFO_CAN_READ(_info)) {
 			lcd_read_busy_and_addr(_info);
 		} else {
-			_delay_us(HD44780_EXEC_TIME_US);
+			_lcd_exec_delay(exec);
 		}
-	#else
-	#	if LCD_HD44780_PIN_ALLOW_RW
-			lcd_read_busy_and_addr();
+	#elif __LCD_BF_DEFERRED
+		(void)exec;
+	#	if __LCD_DUAL_E
+			_lcd_busy |= _lcd_bus;
+	#	else
+			_lcd_busy = true;
+	#	endif
+	#elif __LCD_TIMER_WAIT
+		_lcd_busy_since = LCD_HD44780_PIN_TIMER();
+	#	if LCD_HD44780_PIN_CALIBRATE
+			if (_lcd_calibrating) {
+				_lcd_calibrate(exec);
+				return;
+			}
+			if (exec == __LCD_EXEC_DATA) {
+				_lcd_busy_ticks = _lcd_data_exec_ticks;
+			} else {
+				_lcd_busy_ticks = __LCD_EXEC_IS_LONG(exec) ? _lcd_long_exec_ticks : _lcd_exec_ticks;
+			}
 	#	else
-			_delay_us(HD44780_EXEC_TIME_US);
+			_lcd_busy_ticks = _lcd_exec_ticks_of(exec);
+	#	endif
+	#	if !LCD_HD44780_PIN_DEFERRED_WAIT
+			_lcd_wait_ready();
 	#	endif
+	#elif LCD_HD44780_PIN_ALLOW_RW
+		(void)exec;
+		lcd_read_busy_and_addr();
+	#else
+		_lcd_exec_delay(exec);
 	#endif
 }
 
-static void _lcd_command(__LCD_MULTIMODE_ONLY_INFO_ARG_WITH_COMMA(info) const byte_t ch) {
-	#if LCD_HD44780_PIN_MULTI_MODE
-		pin_off(*(_info->rs_port), _info->rs_pin);
-	#else
-		PIN_OFF(LCD_HD44780_PIN_RS_PORT, LCD_HD44780_PIN_RS_PIN);
+__LCD_STATIC void _lcd_write(__LCD_MULTIMODE_ONLY_INFO_ARG_WITH_COMMA(info) const byte_t ch) {
+	#if __LCD_DUAL_E
+		_lcd_bus = _lcd_e;
 	#endif
-	lcd_byte(__LCD_MULTIMODE_ONLY_VAR_WITH_COMMA(info) ch);
-	#if LCD_HD44780_PIN_MULTI_MODE
-		pin_on(*(_info->rs_port), _info->rs_pin);// Default on - data
-	#else
-		PIN_ON(LCD_HD44780_PIN_RS_PORT, LCD_HD44780_PIN_RS_PIN);// Default on - data
+	#if __LCD_WAIT_DEFERRED
+		_lcd_wait_ready();
 	#endif
+	_lcd_byte(__LCD_MULTIMODE_ONLY_VAR_WITH_COMMA(info) ch);
+	_lcd_exec_wait(__LCD_MULTIMODE_ONLY_VAR_WITH_COMMA(info) __LCD_EXEC_DATA);
 }
 
-static void _lcd_long_command(__LCD_MULTIMODE_ONLY_INFO_ARG_WITH_COMMA(info) const byte_t ch) {
+__LCD_STATIC void _lcd_instruction(__LCD_MULTIMODE_ONLY_INFO_ARG_WITH_COMMA(info) const byte_t ch, const uint8_t exec) {
 	#if LCD_HD44780_PIN_MULTI_MODE
 		pin_off(*(_info->rs_port), _info->rs_pin);
 		_lcd_byte(_info, ch);
 		pin_on(*(_info->rs_port), _info->rs_pin);// Default on - data
-		if (flag_is_set(_info->flags, __HD44780_CONF_READ_BIT)) {
-			lcd_read_busy_and_addr(_info);
-		} else {
-			_delay_us(HD44780_LONG_EXEC_TIME_US);
-		}
 	#else
+	#	if __LCD_WAIT_DEFERRED
+			_lcd_wait_ready(); // Polling the busy flag switches RS
+	#	endif
 		PIN_OFF(LCD_HD44780_PIN_RS_PORT, LCD_HD44780_PIN_RS_PIN);
 		_lcd_byte(ch);
 		PIN_ON(LCD_HD44780_PIN_RS_PORT, LCD_HD44780_PIN_RS_PIN);// Default on - data
-	#	if LCD_HD44780_PIN_ALLOW_RW
-			lcd_read_busy_and_addr();
-	#	else
-			_delay_us(HD44780_LONG_EXEC_TIME_US);
+	#endif
+	_lcd_exec_wait(__LCD_MULTIMODE_ONLY_VAR_WITH_COMMA(info) exec);
+}
+
+#	if __LCD_DUAL_E
+// The address counters of the controllers are separate, the other settings are common
+static byte_t _lcd_instruction_bus(const byte_t ch) {
+	if ((ch & _HD44780_DDRAM) || (((ch & ~_HD44780_CURSOR_MASK) == _HD44780_CURSOR) && flag_is_clear(ch, __HD44780_SCN_BIT))) {
+		return __LCD_E_READ;
+	}
+	return __LCD_E_BOTH;
+}
+#	endif
+
+__LCD_STATIC void _lcd_command(__LCD_MULTIMODE_ONLY_INFO_ARG_WITH_COMMA(info) const byte_t ch) {
+	#if __LCD_DUAL_E
+		_lcd_bus = _lcd_instruction_bus(ch);
+	#endif
+	_lcd_instruction(__LCD_MULTIMODE_ONLY_VAR_WITH_COMMA(info) ch, __LCD_EXEC_CMD);
+}
+
+__LCD_STATIC void _lcd_long_command(__LCD_MULTIMODE_ONLY_INFO_ARG_WITH_COMMA(info) const byte_t ch) {
+	#if __LCD_DUAL_E
+		_lcd_bus = __LCD_E_BOTH; // Both controllers execute it at the same time
+	#endif
+	_lcd_instruction(__LCD_MULTIMODE_ONLY_VAR_WITH_COMMA(info) ch, __LCD_EXEC_OF_LONG(ch));
+}
+
+#	if __LCD_DUAL_E
+// Shows the cursor only by the controller of the current rows
+static void _lcd_display_sync(void) {
+	const byte_t e = __LCD_E_READ;
+	_lcd_bus = e;
+	_lcd_instruction(_HD44780_DISPLAY | _lcd_disp, __LCD_EXEC_CMD);
+	_lcd_bus = e ^ __LCD_E_BOTH;
+	_lcd_instruction(_HD44780_DISPLAY | (_lcd_disp & ~(HD44780_C_ON | HD44780_B_ON)), __LCD_EXEC_CMD);
+}
+
+static void _lcd_select(const byte_t e) {
+	const byte_t prev = __LCD_E_READ;
+	_lcd_e = e;
+	if ((__LCD_E_READ != prev) && (_lcd_disp & (HD44780_C_ON | HD44780_B_ON))) {
+		_lcd_display_sync(); // The cursor follows the current rows
+	}
+}
+#	endif
+#endif // LCD_HD44780_PIN_ASYNC
+
+/** \cond NO_DOC */
+#define __LCD_AC_TRACK			(LCD_HD44780_PIN_SHADOW || LCD_HD44780_PIN_TRACK_ADDR || LCD_HD44780_PIN_GLYPH_CACHE) // The shadow buffer always tracks the address counter
+#define __LCD_AC_TRACK_ONLY		(__LCD_AC_TRACK && !LCD_HD44780_PIN_SHADOW)
+/** \endcond */
+
+#if LCD_HD44780_PIN_SHADOW
+static void _lcd_shadow_write(const byte_t ch);
+#elif __LCD_AC_TRACK_ONLY
+static void _lcd_ac_step(void);
+#endif
+
+__LCD_API void lcd_byte(__LCD_MULTIMODE_ONLY_INFO_ARG_WITH_COMMA(info) const byte_t ch) {
+	#if LCD_HD44780_PIN_SHADOW
+		_lcd_shadow_write(ch);
+	#else
+		_lcd_write(__LCD_MULTIMODE_ONLY_VAR_WITH_COMMA(info) ch);
+	#	if __LCD_AC_TRACK_ONLY
+		_lcd_ac_step();
 	#	endif
 	#endif
 }
 
-void lcd_custom_char(__LCD_MULTIMODE_ONLY_INFO_ARG_WITH_COMMA(info) const byte_t char_pos, const byte_t custom_char[8]) {
+#if __LCD_AC_TRACK
+#	define __LCD_AC_CGRAM				0x80 // The address counter points to CGRAM
+#	define __LCD_AC_UNKNOWN				0xFF // The address counter can't be tracked
+#	define __LCD_AC_FOLLOW				(_lcd_entry == HD44780_ID_INC) // Only increment without shift can be tracked
+
+static byte_t _lcd_entry; // Current entry mode flags
+static byte_t _lcd_ac = __LCD_AC_UNKNOWN; // Controller address counter
+#	if LCD_HD44780_PIN_SHADOW
+static byte_t _lcd_cur = __LCD_AC_UNKNOWN; // Where the next symbol goes, can be ahead of the address counter
+#		define __LCD_AC_SET(_a)			(_lcd_ac = _lcd_cur = (_a))
+#	else
+#		define __LCD_AC_SET(_a)			(_lcd_ac = (_a))
+#	endif
+
+static byte_t _lcd_addr_next(const byte_t addr) {
+	#if __INFO_ROW_COUT == 1
+		if (addr == __HD44780_1L_LAST_DDRAM_ADR) {
+			return __HD44780_ROW_1_DDRAM_ADR;
+		}
+	#else
+		if (addr == __HD44780_2L_ROW_1_LAST_DDRAM_ADR) {
+			return __HD44780_ROW_2_DDRAM_ADR;
+		}
+		if (addr == __HD44780_2L_ROW_2_LAST_DDRAM_ADR) {
+			return __HD44780_ROW_1_DDRAM_ADR;
+		}
+	#endif
+	return addr + 1;
+}
+
+static void _lcd_ac_reset(void) {
+	__LCD_AC_SET(__LCD_AC_FOLLOW ? __HD44780_ROW_1_DDRAM_ADR : __LCD_AC_UNKNOWN);
+}
+
+#	if __LCD_AC_TRACK_ONLY
+static void _lcd_ac_step(void) {
+	if (_lcd_ac < __LCD_AC_CGRAM) {
+		_lcd_ac = _lcd_addr_next(_lcd_ac);
+	}
+}
+#	endif
+#endif // __LCD_AC_TRACK
+
+#if LCD_HD44780_PIN_SHADOW
+#	define __LCD_SHADOW_ALL_ROWS		(_BV(__INFO_ROW_COUT) - 1)
+
+static byte_t _lcd_shadow[__INFO_ROW_COUT * __INFO_COL_COUT]; // Visible cells contents
+static byte_t _lcd_shadow_dirty; // Rows that should be sent even if the shadow cells are the same
+
+static const byte_t _lcd_row_addr[__INFO_ROW_COUT] = {
+	__INFO_ROW_1_ADDR,
+#	if __INFO_ROW_COUT >= 2
+	__INFO_ROW_2_ADDR,
+#	endif
+#	if __INFO_ROW_COUT >= 4
+	__INFO_ROW_3_ADDR,
+	__INFO_ROW_4_ADDR,
+#	endif
+};
+
+static byte_t _lcd_shadow_index(const byte_t addr, byte_t *const row) {
+	for (byte_t r = 0; r < __INFO_ROW_COUT; r++) {
+		byte_t col = addr - _lcd_row_addr[r];
+		if (col < __INFO_COL_COUT) {
+			*row = r;
+			return r * __INFO_COL_COUT + col;
+		}
+	}
+	return __LCD_AC_UNKNOWN; // Invisible DDRAM cell
+}
+
+void lcd_sync(void) {
+	if ((_lcd_cur < __LCD_AC_CGRAM) && (_lcd_cur != _lcd_ac)) {
+		_lcd_command(_HD44780_DDRAM | _lcd_cur);
+		_lcd_ac = _lcd_cur;
+	}
+}
+
+void lcd_shadow_invalidate(void) {
+	_lcd_shadow_dirty = __LCD_SHADOW_ALL_ROWS;
+}
+
+static void _lcd_shadow_write(const byte_t ch) {
+	if (_lcd_cur < __LCD_AC_CGRAM) {
+		byte_t row;
+		byte_t index = _lcd_shadow_index(_lcd_cur, &row);
+		if (index != __LCD_AC_UNKNOWN) {
+			if ((_lcd_shadow[index] == ch) && flag_is_clear(_lcd_shadow_dirty, row)) {
+				_lcd_cur = _lcd_addr_next(_lcd_cur); // The cell is up to date, just skip it
+				return;
+			}
+			_lcd_shadow[index] = ch;
+		}
+		lcd_sync(); // The address is only sent where a run of changed cells starts
+		_lcd_cur = _lcd_addr_next(_lcd_cur);
+		_lcd_ac = _lcd_cur;
+	} else if (_lcd_cur == __LCD_AC_UNKNOWN) {
+		_lcd_shadow_dirty = __LCD_SHADOW_ALL_ROWS; // Somewhere on the display
+	}
+	_lcd_write(ch);
+}
+#endif // LCD_HD44780_PIN_SHADOW
+
+#if LCD_HD44780_PIN_GLYPH_CACHE
+#	define __LCD_GLYPH_SLOTS			8
+
+static const __flash byte_t *_lcd_glyph_slot[__LCD_GLYPH_SLOTS]; // Resident glyphs, NULL for unknown slot contents
+static byte_t _lcd_glyph_lru[__LCD_GLYPH_SLOTS] = {7, 6, 5, 4, 3, 2, 1, 0}; // Slots from the most recently used one, the lcd_glyph_invalidate() order
+static byte_t _lcd_glyph_pinned; // Slots that are never replaced
+#endif
+
+__LCD_API void lcd_custom_char(__LCD_MULTIMODE_ONLY_INFO_ARG_WITH_COMMA(info) const byte_t char_pos, const byte_t custom_char[8]) {
 	if (char_pos < 8) {
+		#if LCD_HD44780_PIN_GLYPH_CACHE
+			_lcd_glyph_slot[char_pos] = NULL;
+			_lcd_glyph_pinned &= ~_BV(char_pos);
+		#endif
 		lcd_cgr_adr(__LCD_MULTIMODE_ONLY_VAR_WITH_COMMA(info) (char_pos * 8));
 		for(byte_t char_byte = 0; char_byte < 8; char_byte++) {
 			lcd_byte(__LCD_MULTIMODE_ONLY_VAR_WITH_COMMA(info) custom_char[char_byte]);
@@ -205,123 +724,147 @@ void lcd_custom_char(__LCD_MULTIMODE_ONLY_INFO_ARG_WITH_COMMA(info) const byte_t
     }
 }
 
-lcd_info_t lcd_init(const lcd_init_t *const config) {
+#define __LCD_DDRAM_UNKNOWN			0xFF // The DDRAM address can't be restored
+
+// The DDRAM address to return to after a CGRAM upload
+__LCD_STATIC byte_t _lcd_ddram_addr(__LCD_MULTIMODE_ONLY_INFO_ARG(info)) {
+	#if __LCD_AC_TRACK
+	#	if LCD_HD44780_PIN_SHADOW
+		const byte_t addr = _lcd_cur; // The shadow buffer can postpone the address
+	#	else
+		const byte_t addr = _lcd_ac;
+	#	endif
+		if (addr != __LCD_AC_UNKNOWN) {
+			return (addr < __LCD_AC_CGRAM) ? addr : __LCD_DDRAM_UNKNOWN;
+		}
+	#endif
 	#if LCD_HD44780_PIN_MULTI_MODE
-		lcd_info_t _info;
-		_info.flags = 0x00;
-		_info.data_ddr = config->data_ddr;
-		_info.data_port = config->data_port;
-		_info.data_pin = config->data_pin;
-		_info.rs_port = config->rs_port;
-		_info.rs_pin = config->rs_pin;
-		_info.e_port = config->e_port;
-		_info.e_pin = config->e_pin;
-		_info.rw_port = config->rw_port;
-		_info.rw_pin = config->rw_pin;
-
-		bool interface_dl_is_full = flag_is_set(config->flags, __HD44780_INIT_IDL_BIT);
-
-		pin_to_write_d_lo(*(config->rs_ddr), *(config->rs_port), config->rs_pin);
-		pin_to_write_d_lo(*(config->e_ddr), *(config->e_port), config->e_pin);
-		bool is_read_enable = flag_is_set(config->flags, __HD44780_INIT_READ_BIT);
-		if (is_read_enable) {
-			pin_to_write_d_lo(*(config->rw_ddr), *(config->rw_port), config->rw_pin); // Default off
-		} else {
-			_info.data_ddr = 0;
-			_info.data_pin = 0;
-			_info.rw_port = 0;
-			_info.rw_pin = 0;
-			_info.flags |= _HD44780_CONF_READ_OFF;
+		if (__LCD_INFO_CAN_READ(_info)) {
+			return lcd_read_busy_and_addr(_info);
 		}
+	#elif LCD_HD44780_PIN_ALLOW_RW
+		return lcd_read_busy_and_addr(); // Somewhere in DDRAM after the decrement or shift
+	#endif
+	return __LCD_DDRAM_UNKNOWN;
+}
 
-		if (interface_dl_is_full) {
-			_info.port_mask = 0xFF;
-		} else {
-			_info.port_mask = _HD44780_HALF_DATA_MASK << (config->data_shift);
+// The slots follow each other in CGRAM, so the address command is sent only once
+__LCD_STATIC void _lcd_cgram_load(__LCD_MULTIMODE_ONLY_INFO_ARG_WITH_COMMA(info) const byte_t first_slot, const __flash byte_t src[], const uint8_t count) {
+	const byte_t addr = _lcd_ddram_addr(__LCD_MULTIMODE_ONLY_VAR(info));
+	#if __LCD_DUAL_E
+		const byte_t e = __LCD_E_READ;
+	#endif
+	lcd_cgr_adr(__LCD_MULTIMODE_ONLY_VAR_WITH_COMMA(info) (first_slot * 8));
+	for (uint8_t i = 0; i < (uint8_t)(count * 8); i++) {
+		lcd_byte(__LCD_MULTIMODE_ONLY_VAR_WITH_COMMA(info) src[i]);
+	}
+	if (addr != __LCD_DDRAM_UNKNOWN) {
+		#if __LCD_DUAL_E
+			_lcd_select(e); // The address belongs to the controller of the current rows
+		#endif
+		lcd_ddr_adr(__LCD_MULTIMODE_ONLY_VAR_WITH_COMMA(info) addr);
+	}
+}
+
+__LCD_API void lcd_load_glyph_set(__LCD_MULTIMODE_ONLY_INFO_ARG_WITH_COMMA(info) const byte_t first_slot, const __flash byte_t glyphs[][8], uint8_t count) {
+	if (first_slot >= 8) {
+		return;
+	}
+	if (count > 8 - first_slot) {
+		count = 8 - first_slot;
+	}
+	if (!count) {
+		return;
+	}
+	#if LCD_HD44780_PIN_GLYPH_CACHE
+		for (byte_t slot = first_slot; slot < first_slot + count; slot++) {
+			_lcd_glyph_slot[slot] = NULL;
+			_lcd_glyph_pinned &= ~_BV(slot);
 		}
+	#endif
+	_lcd_cgram_load(__LCD_MULTIMODE_ONLY_VAR_WITH_COMMA(info) first_slot, glyphs[0], count);
+}
 
-		port_to_write(*(config->data_ddr), _info.port_mask);
-	#else
-		PIN_TO_WRITE_D_LO(LCD_HD44780_PIN_RS_PORT, LCD_HD44780_PIN_RS_PIN);
-		PIN_TO_WRITE_D_LO(LCD_HD44780_PIN_E_PORT, LCD_HD44780_PIN_E_PIN);
-	#	if LCD_HD44780_PIN_ALLOW_RW
-			PIN_TO_WRITE_D_LO(LCD_HD44780_PIN_RW_PORT, LCD_HD44780_PIN_RW_PIN); // Default off
+#if LCD_HD44780_PIN_GLYPH_CACHE
+void lcd_glyph_invalidate(void) {
+	for (byte_t slot = 0; slot < __LCD_GLYPH_SLOTS; slot++) {
+		_lcd_glyph_slot[slot] = NULL;
+		_lcd_glyph_lru[slot] = __LCD_GLYPH_SLOTS - 1 - slot; // The first slots are taken first
+	}
+	_lcd_glyph_pinned = 0;
+}
+
+static void _lcd_glyph_touch(const byte_t slot) {
+	byte_t i = 0;
+	while (_lcd_glyph_lru[i] != slot) {
+		i++;
+	}
+	for (; i; i--) {
+		_lcd_glyph_lru[i] = _lcd_glyph_lru[i - 1];
+	}
+	_lcd_glyph_lru[0] = slot;
+}
+
+
+static byte_t _lcd_glyph_get(const __flash byte_t glyph[8]) {
+	byte_t slot;
+	for (slot = 0; slot < __LCD_GLYPH_SLOTS; slot++) {
+		if (_lcd_glyph_slot[slot] == glyph) {
+			_lcd_glyph_touch(slot);
+			return slot;
+		}
+	}
+	for (byte_t i = __LCD_GLYPH_SLOTS; i; i--) {
+		slot = _lcd_glyph_lru[i - 1];
+		if (flag_is_clear(_lcd_glyph_pinned, slot)) {
+			_lcd_cgram_load(slot, glyph, 1);
+			_lcd_glyph_slot[slot] = glyph;
+			_lcd_glyph_touch(slot);
+			return slot;
+		}
+	}
+	return LCD_GLYPH_NONE;
+}
+
+byte_t lcd_glyph(const __flash byte_t glyph[8]) {
+	return _lcd_glyph_get(glyph);
+}
+
+byte_t lcd_glyph_pin(const __flash byte_t glyph[8]) {
+	const byte_t slot = _lcd_glyph_get(glyph);
+	if (slot != LCD_GLYPH_NONE) {
+		_lcd_glyph_pinned |= _BV(slot);
+	}
+	return slot;
+}
+
+void lcd_glyph_unpin(const __flash byte_t glyph[8]) {
+	for (byte_t slot = 0; slot < __LCD_GLYPH_SLOTS; slot++) {
+		if (_lcd_glyph_slot[slot] == glyph) {
+			_lcd_glyph_pinned &= ~_BV(slot);
+		}
+	}
+}
+#endif // LCD_HD44780_PIN_GLYPH_CACHE
+
+// Runs the initialization sequence after the pins setup
+__LCD_STATIC void _lcd_start(__LCD_MULTIMODE_ONLY_INFO_ARG_WITH_COMMA(info) const uint8_t flags) {
+	#if LCD_HD44780_PIN_MULTI_MODE
+		const bool is_read_enable = __LCD_INFO_CAN_READ(_info);
+	#endif
+	#if __LCD_DUAL_E
+		_lcd_bus = __LCD_E_BOTH; // Both controllers are initialized at the same time
+		_lcd_e = __LCD_E1;
+		_lcd_disp = 0;
+	#	if __LCD_BF_DEFERRED
+		_lcd_busy = 0;
 	#	endif
-		PORT_TO_WRITE(LCD_HD44780_PIN_DATA_PORT, __INFO_PORT_MASK);
 	#endif
 	_delay_ms(HD44780_WAIT_INIT_MS+3);
 
-	uint8_t set_flags = flag_is_set(config->flags, __HD44780_INIT_FONT_BIT) ? HD44780_F_BIG : HD44780_F_NORMAL;
+	uint8_t set_flags = flag_is_set(flags, __HD44780_INIT_FONT_BIT) ? HD44780_F_BIG : HD44780_F_NORMAL;
 	#if LCD_HD44780_PIN_MULTI_MODE
-	switch(config->display_type) {
-		case LCD_8X1:
-			set_flags |= HD44780_N_1L;
-			_info.row_cout = 1;
-			_info.col_cout = 16;
-			_info.row_1_addr = HD44780_ROW_1_DDRAM_ADR;
-			break;
-		case LCD_16X1:
-			set_flags |= HD44780_N_1L;
-			_info.row_cout = 1;
-			_info.col_cout = 16;
-			_info.row_1_addr = HD44780_ROW_1_DDRAM_ADR;
-			break;
-		case LCD_16X2:
-			set_flags |= HD44780_N_2L;
-			_info.row_cout = 2;
-			_info.col_cout = 16;
-			_info.row_1_addr = HD44780_ROW_1_DDRAM_ADR;
-			_info.row_2_addr = HD44780_ROW_2_DDRAM_ADR;
-			break;
-		case LCD_20X2:
-			set_flags |= HD44780_N_2L;
-			_info.row_cout = 2;
-			_info.col_cout = 20;
-			_info.row_1_addr = HD44780_ROW_1_DDRAM_ADR;
-			_info.row_2_addr = HD44780_ROW_2_DDRAM_ADR;
-			break;
-		case LCD_32X2:
-			set_flags |= HD44780_N_2L;
-			_info.row_cout = 2;
-			_info.col_cout = 32;
-			_info.row_1_addr = HD44780_ROW_1_DDRAM_ADR;
-			_info.row_2_addr = HD44780_ROW_2_DDRAM_ADR;
-			break;
-		case LCD_40X2:
-			set_flags |= HD44780_N_2L;
-			_info.row_cout = 2;
-			_info.col_cout = 40;
-			_info.row_1_addr = HD44780_ROW_1_DDRAM_ADR;
-			_info.row_2_addr = HD44780_ROW_2_DDRAM_ADR;
-			break;
-		case LCD_16X4:
-			set_flags |= HD44780_N_2L;
-			_info.row_cout = 4;
-			_info.col_cout = 16;
-			_info.row_1_addr = HD44780_ROW_1_DDRAM_ADR;
-			_info.row_2_addr = HD44780_ROW_2_DDRAM_ADR;
-			_info.row_3_addr = HD44780_ROW_3_DDRAM_ADR;
-			_info.row_4_addr = HD44780_ROW_4_DDRAM_ADR;
-			break;
-		case LCD_20X4:
-			set_flags |= HD44780_N_2L;
-			_info.row_cout = 4;
-			_info.col_cout = 20;
-			_info.row_1_addr = HD44780_ROW_1_DDRAM_ADR;
-			_info.row_2_addr = HD44780_ROW_2_DDRAM_ADR;
-			_info.row_3_addr = HD44780_ROW_3_20x4_DDRAM_ADR;
-			_info.row_4_addr = HD44780_ROW_4_20x4_DDRAM_ADR;
-			break;
-		/*case LCD_40X4:
-			set_flags |= HD44780_N_2L;
-			_info.row_cout = 4;
-			_info.col_cout = 40;
-			_info.row_1_addr = HD44780_ROW_1_DDRAM_ADR;
-			_info.row_2_addr = HD44780_ROW_2_DDRAM_ADR;
-			_info.row_3_addr = HD44780_ROW_1_DDRAM_ADR;
-			_info.row_4_addr = HD44780_ROW_2_DDRAM_ADR;
-			break;*/
-	}
+		set_flags |= (_info->row_cout == 1) ? HD44780_N_1L : HD44780_N_2L;
 	#else
 	#	if (LCD_HD44780_PIN_DISPLAY_TYPE == HD44780_DISPLAY_8X1) || (LCD_HD44780_PIN_DISPLAY_TYPE == HD44780_DISPLAY_16X1)
 			set_flags |= HD44780_N_1L;
@@ -331,39 +874,31 @@ lcd_info_t lcd_init(const lcd_init_t *const config) {
 	#endif
 
 	#if LCD_HD44780_PIN_MULTI_MODE
-		if (interface_dl_is_full) {
-			_info.flags |= _HD44780_CONF_IDL_8BIT;
-
-			_lcd_send(&_info, _HD44780_INIT_8_1_CMD);
+		if (flag_is_set(_info->flags, __HD44780_CONF_IDL_BIT)) {
+			_lcd_send(_info, _HD44780_INIT_8_1_CMD);
 			_delay_ms(HD44780_INIT_1_MS);
 
-			_lcd_send(&_info, _HD44780_INIT_8_2_CMD);
+			_lcd_send(_info, _HD44780_INIT_8_2_CMD);
 			_delay_us(HD44780_INIT_2_US);
 
-			_lcd_send(&_info, _HD44780_INIT_8_3_CMD);
+			_lcd_send(_info, _HD44780_INIT_8_3_CMD);
 			_delay_us(HD44780_INIT_3_US);
 
-			_info.data_shift = 0;
 			set_flags |= HD44780_DL_8BIT;
 		} else {
-			_lcd_send(&_info, _HD44780_INIT_4_1_CMD);
+			_lcd_send(_info, _HD44780_INIT_4_1_CMD);
 			_delay_ms(HD44780_INIT_1_MS);
 
-			_lcd_send(&_info, _HD44780_INIT_4_2_CMD);
+			_lcd_send(_info, _HD44780_INIT_4_2_CMD);
 			_delay_us(HD44780_INIT_2_US);
 
-			_lcd_send(&_info, _HD44780_INIT_4_3_CMD);
+			_lcd_send(_info, _HD44780_INIT_4_3_CMD);
 			_delay_us(HD44780_INIT_3_US);
 
-			_lcd_send(&_info, _HD44780_INIT_4_4_CMD);
+			_lcd_send(_info, _HD44780_INIT_4_4_CMD);
 			_delay_us(HD44780_INIT_4_4_US);
 
-			_info.data_shift = config->data_shift;
 			set_flags |= HD44780_DL_4BIT;
-			_info.flags |= _HD44780_CONF_IDL_4BIT;
-		}
-		if (is_read_enable) {
-			_info.flags |= _HD44780_CONF_READ_ON;
 		}
 	#else
 	#	if LCD_HD44780_PIN_IDL_8BIT
@@ -394,133 +929,314 @@ lcd_info_t lcd_init(const lcd_init_t *const config) {
 	#	endif
 	#endif
 
-	lcd_func_set(__LCD_MULTIMODE_ONLY_VAR_BY_REF_WITH_COMMA(info) set_flags);
+	#if LCD_HD44780_PIN_CALIBRATE
+		_lcd_exec_ticks = 0;
+		_lcd_calibrating = true;
+	#endif
+	lcd_func_set(__LCD_MULTIMODE_ONLY_VAR_WITH_COMMA(info) set_flags);
 	#if LCD_HD44780_PIN_MULTI_MODE
 		if (!is_read_enable) {
 			_delay_us(HD44780_INIT_OTHER_ADD_US);
 		}
 	#else
-	#	if !LCD_HD44780_PIN_ALLOW_RW
+	#	if LCD_HD44780_PIN_ASYNC
+			lcd_flush(); // The delay should follow the execution, not the queuing
+	#	endif
+	#	if !LCD_HD44780_PIN_ALLOW_RW || LCD_HD44780_PIN_ASYNC
 			_delay_us(HD44780_INIT_OTHER_ADD_US);
 	#	endif
 	#endif
 
-	lcd_display_ctrl(__LCD_MULTIMODE_ONLY_VAR_BY_REF_WITH_COMMA(info) HD44780_D_OFF | HD44780_C_OFF | HD44780_B_OFF);
+	lcd_display_ctrl(__LCD_MULTIMODE_ONLY_VAR_WITH_COMMA(info) HD44780_D_OFF | HD44780_C_OFF | HD44780_B_OFF);
 	#if LCD_HD44780_PIN_MULTI_MODE
 		if (!is_read_enable) {
 			_delay_us(HD44780_INIT_OTHER_ADD_US);
 		}
 	#else
-	#	if !LCD_HD44780_PIN_ALLOW_RW
+	#	if LCD_HD44780_PIN_ASYNC
+			lcd_flush(); // The delay should follow the execution, not the queuing
+	#	endif
+	#	if !LCD_HD44780_PIN_ALLOW_RW || LCD_HD44780_PIN_ASYNC
 			_delay_us(HD44780_INIT_OTHER_ADD_US);
 	#	endif
 	#endif
 
 	_delay_us(1500);
 
-	lcd_clear(__LCD_MULTIMODE_ONLY_VAR_BY_REF(info));
+	lcd_clear(__LCD_MULTIMODE_ONLY_VAR(info));
 	#if LCD_HD44780_PIN_MULTI_MODE
 		if (!is_read_enable) {
 			_delay_us(HD44780_INIT_OTHER_ADD_US);
 		}
 	#else
-	#	if !LCD_HD44780_PIN_ALLOW_RW
+	#	if LCD_HD44780_PIN_ASYNC
+			lcd_flush(); // The delay should follow the execution, not the queuing
+	#	endif
+	#	if !LCD_HD44780_PIN_ALLOW_RW || LCD_HD44780_PIN_ASYNC
 			_delay_us(HD44780_INIT_OTHER_ADD_US);
 	#	endif
 	#endif
 
-	lcd_entry_mode(__LCD_MULTIMODE_ONLY_VAR_BY_REF_WITH_COMMA(info) (flag_is_set(config->flags, __HD44780_INIT_MOV_DIR_BIT) ? HD44780_ID_INC : HD44780_ID_DEC) | (flag_is_set(config->flags, __HD44780_INIT_SHIFT_BIT) ? HD44780_S_ON : HD44780_S_OFF));
+	lcd_entry_mode(__LCD_MULTIMODE_ONLY_VAR_WITH_COMMA(info) (flag_is_set(flags, __HD44780_INIT_MOV_DIR_BIT) ? HD44780_ID_INC : HD44780_ID_DEC) | (flag_is_set(flags, __HD44780_INIT_SHIFT_BIT) ? HD44780_S_ON : HD44780_S_OFF));
 	#if LCD_HD44780_PIN_MULTI_MODE
 		if (!is_read_enable) {
 			_delay_us(HD44780_INIT_OTHER_ADD_US);
 		}
 	#else
-	#	if !LCD_HD44780_PIN_ALLOW_RW
+	#	if LCD_HD44780_PIN_ASYNC
+			lcd_flush(); // The delay should follow the execution, not the queuing
+	#	endif
+	#	if !LCD_HD44780_PIN_ALLOW_RW || LCD_HD44780_PIN_ASYNC
 			_delay_us(HD44780_INIT_OTHER_ADD_US);
 	#	endif
 	#endif
 
-	if (flag_is_set(config->flags, __HD44780_INIT_DISP_BIT)) {
-		lcd_display_ctrl(__LCD_MULTIMODE_ONLY_VAR_BY_REF_WITH_COMMA(info) HD44780_D_ON | (flag_is_set(config->flags, __HD44780_INIT_CURSOR_BIT) ? HD44780_C_ON : HD44780_C_OFF) | (flag_is_set(config->flags, __HD44780_INIT_BLINKING_BIT) ? HD44780_B_ON : HD44780_B_OFF));
+	if (flag_is_set(flags, __HD44780_INIT_DISP_BIT)) {
+		lcd_display_ctrl(__LCD_MULTIMODE_ONLY_VAR_WITH_COMMA(info) HD44780_D_ON | (flag_is_set(flags, __HD44780_INIT_CURSOR_BIT) ? HD44780_C_ON : HD44780_C_OFF) | (flag_is_set(flags, __HD44780_INIT_BLINKING_BIT) ? HD44780_B_ON : HD44780_B_OFF));
 	}
-	#if LCD_HD44780_PIN_MULTI_MODE
-	return _info;
-	#elif LCD_HD44780_PIN_SINGLE_SOME_CODE
-	return 0;
+	#if LCD_HD44780_PIN_CALIBRATE
+		_lcd_calibrating = false;
+	#endif
+	#if LCD_HD44780_PIN_ASYNC
+		lcd_flush();
 	#endif
 }
 
-void lcd_clear(__LCD_MULTIMODE_ONLY_INFO_ARG(info)) {
+
+#if LCD_HD44780_PIN_FLASH_INFO
+void lcd_setup(const lcd_info_t *const info) {
+	pin_to_write_d_lo(*(info->rs_ddr), *(info->rs_port), info->rs_pin);
+	pin_to_write_d_lo(*(info->e_ddr), *(info->e_port), info->e_pin);
+	if (flag_is_set(info->flags, __HD44780_CONF_READ_BIT)) {
+		pin_to_write_d_lo(*(info->rw_ddr), *(info->rw_port), info->rw_pin); // Default off
+	}
+	port_to_write(*(info->data_ddr), info->port_mask);
+}
+
+void lcd_init(const lcd_info_t *const info, const lcd_init_t *const config) {
+	lcd_setup(info);
+	_lcd_start(info, config->flags);
+}
+#elif LCD_HD44780_PIN_MULTI_MODE
+lcd_info_struct lcd_setup(const lcd_init_t *const config) {
+	const bool interface_dl_is_full = flag_is_set(config->flags, __HD44780_INIT_IDL_BIT);
+	const bool is_read_enable = flag_is_set(config->flags, __HD44780_INIT_READ_BIT);
+	lcd_info_struct _info = { // The port members are constant, so they can only be initialized
+		.flags = (interface_dl_is_full ? _HD44780_CONF_IDL_8BIT : _HD44780_CONF_IDL_4BIT) | (is_read_enable ? _HD44780_CONF_READ_ON : _HD44780_CONF_READ_OFF),
+		.data_ddr = is_read_enable ? config->data_ddr : 0,
+		.data_port = config->data_port,
+		.data_pin = is_read_enable ? config->data_pin : 0,
+		.data_shift = interface_dl_is_full ? 0 : config->data_shift,
+		.port_mask = interface_dl_is_full ? 0xFF : (_HD44780_HALF_DATA_MASK << (config->data_shift)),
+		.rs_port = config->rs_port,
+		.rs_pin = config->rs_pin,
+		.e_port = config->e_port,
+		.e_pin = config->e_pin,
+		.rw_port = is_read_enable ? config->rw_port : 0,
+		.rw_pin = is_read_enable ? config->rw_pin : 0,
+	};
+
+	pin_to_write_d_lo(*(config->rs_ddr), *(config->rs_port), config->rs_pin);
+	pin_to_write_d_lo(*(config->e_ddr), *(config->e_port), config->e_pin);
+	if (is_read_enable) {
+		pin_to_write_d_lo(*(config->rw_ddr), *(config->rw_port), config->rw_pin); // Default off
+	}
+	port_to_write(*(config->data_ddr), _info.port_mask);
+
+	switch(config->display_type) {
+		case LCD_8X1:
+			_info.row_cout = 1;
+			_info.col_cout = 8;
+			_info.row_addr[LCD_ROW_1] = HD44780_ROW_1_DDRAM_ADR;
+			break;
+		case LCD_16X1:
+			_info.row_cout = 1;
+			_info.col_cout = 16;
+			_info.row_addr[LCD_ROW_1] = HD44780_ROW_1_DDRAM_ADR;
+			break;
+		case LCD_16X2:
+			_info.row_cout = 2;
+			_info.col_cout = 16;
+			_info.row_addr[LCD_ROW_1] = HD44780_ROW_1_DDRAM_ADR;
+			_info.row_addr[LCD_ROW_2] = HD44780_ROW_2_DDRAM_ADR;
+			break;
+		case LCD_20X2:
+			_info.row_cout = 2;
+			_info.col_cout = 20;
+			_info.row_addr[LCD_ROW_1] = HD44780_ROW_1_DDRAM_ADR;
+			_info.row_addr[LCD_ROW_2] = HD44780_ROW_2_DDRAM_ADR;
+			break;
+		case LCD_32X2:
+			_info.row_cout = 2;
+			_info.col_cout = 32;
+			_info.row_addr[LCD_ROW_1] = HD44780_ROW_1_DDRAM_ADR;
+			_info.row_addr[LCD_ROW_2] = HD44780_ROW_2_DDRAM_ADR;
+			break;
+		case LCD_40X2:
+			_info.row_cout = 2;
+			_info.col_cout = 40;
+			_info.row_addr[LCD_ROW_1] = HD44780_ROW_1_DDRAM_ADR;
+			_info.row_addr[LCD_ROW_2] = HD44780_ROW_2_DDRAM_ADR;
+			break;
+		case LCD_16X4:
+			_info.row_cout = 4;
+			_info.col_cout = 16;
+			_info.row_addr[LCD_ROW_1] = HD44780_ROW_1_DDRAM_ADR;
+			_info.row_addr[LCD_ROW_2] = HD44780_ROW_2_DDRAM_ADR;
+			_info.row_addr[LCD_ROW_3] = HD44780_ROW_3_DDRAM_ADR;
+			_info.row_addr[LCD_ROW_4] = HD44780_ROW_4_DDRAM_ADR;
+			break;
+		case LCD_20X4:
+			_info.row_cout = 4;
+			_info.col_cout = 20;
+			_info.row_addr[LCD_ROW_1] = HD44780_ROW_1_DDRAM_ADR;
+			_info.row_addr[LCD_ROW_2] = HD44780_ROW_2_DDRAM_ADR;
+			_info.row_addr[LCD_ROW_3] = HD44780_ROW_3_20x4_DDRAM_ADR;
+			_info.row_addr[LCD_ROW_4] = HD44780_ROW_4_20x4_DDRAM_ADR;
+			break;
+	}
+	return _info;
+}
+
+lcd_info_t lcd_init(const lcd_init_t *const config) {
+	const lcd_info_struct _info = lcd_setup(config);
+	_lcd_start(&_info, config->flags);
+	return _info;
+}
+#else
+lcd_info_t lcd_init(const lcd_init_t *const config) {
+	#if LCD_HD44780_PIN_ASYNC
+		lcd_flush(); // In case of reinitialization
+	#endif
+	PIN_TO_WRITE_D_LO(LCD_HD44780_PIN_RS_PORT, LCD_HD44780_PIN_RS_PIN);
+	PIN_TO_WRITE_D_LO(LCD_HD44780_PIN_E_PORT, LCD_HD44780_PIN_E_PIN);
+	#if __LCD_DUAL_E
+		PIN_TO_WRITE_D_LO(LCD_HD44780_PIN_E2_PORT, LCD_HD44780_PIN_E2_PIN);
+	#endif
+	#if LCD_HD44780_PIN_ALLOW_RW
+		PIN_TO_WRITE_D_LO(LCD_HD44780_PIN_RW_PORT, LCD_HD44780_PIN_RW_PIN); // Default off
+	#endif
+	PORT_TO_WRITE(LCD_HD44780_PIN_DATA_PORT, __INFO_PORT_MASK);
+	_lcd_start(config->flags);
+	#if LCD_HD44780_PIN_GLYPH_CACHE
+		lcd_glyph_invalidate();
+	#endif
+	#if LCD_HD44780_PIN_SINGLE_SOME_CODE
+		return 0;
+	#endif
+}
+#endif // LCD_HD44780_PIN_FLASH_INFO
+__LCD_API void lcd_clear(__LCD_MULTIMODE_ONLY_INFO_ARG(info)) {
 	_lcd_long_command(__LCD_MULTIMODE_ONLY_VAR_WITH_COMMA(info) _HD44780_CLEAR);
+	#if LCD_HD44780_PIN_SHADOW
+		memset(_lcd_shadow, ' ', sizeof(_lcd_shadow));
+		_lcd_shadow_dirty = 0;
+	#endif
+	#if __LCD_AC_TRACK
+		_lcd_entry |= HD44780_ID_INC; // Clear sets the increment mode
+		_lcd_ac_reset();
+	#endif
+	#if __LCD_DUAL_E
+		_lcd_select(__LCD_E1);
+	#endif
 }
 
-void lcd_home(__LCD_MULTIMODE_ONLY_INFO_ARG_WITH_COMMA(info) const uint8_t flags) {
+__LCD_API void lcd_home(__LCD_MULTIMODE_ONLY_INFO_ARG_WITH_COMMA(info) const uint8_t flags) {
 	_lcd_long_command(__LCD_MULTIMODE_ONLY_VAR_WITH_COMMA(info) _HD44780_HOME | (flags & _HD44780_HOME_MASK));
+	#if __LCD_AC_TRACK
+		_lcd_ac_reset();
+	#endif
+	#if __LCD_DUAL_E
+		_lcd_select(__LCD_E1);
+	#endif
 }
 
-void lcd_entry_mode(__LCD_MULTIMODE_ONLY_INFO_ARG_WITH_COMMA(info) const uint8_t flags) {
+__LCD_API void lcd_entry_mode(__LCD_MULTIMODE_ONLY_INFO_ARG_WITH_COMMA(info) const uint8_t flags) {
+	#if LCD_HD44780_PIN_SHADOW
+		lcd_sync();
+	#endif
+	#if __LCD_AC_TRACK
+		_lcd_entry = flags & _HD44780_ENTRY_MASK;
+		if (!__LCD_AC_FOLLOW) {
+			__LCD_AC_SET(__LCD_AC_UNKNOWN);
+		}
+	#endif
 	_lcd_command(__LCD_MULTIMODE_ONLY_VAR_WITH_COMMA(info) _HD44780_ENTRY | (flags & _HD44780_ENTRY_MASK));
 }
 
-void lcd_display_ctrl(__LCD_MULTIMODE_ONLY_INFO_ARG_WITH_COMMA(info) const uint8_t flags) {
+__LCD_API void lcd_display_ctrl(__LCD_MULTIMODE_ONLY_INFO_ARG_WITH_COMMA(info) const uint8_t flags) {
+	#if __LCD_DUAL_E
+		_lcd_disp = flags & _HD44780_DISPLAY_MASK;
+		if (_lcd_disp & (HD44780_C_ON | HD44780_B_ON)) {
+			_lcd_display_sync();
+			return;
+		}
+	#endif
 	_lcd_command(__LCD_MULTIMODE_ONLY_VAR_WITH_COMMA(info) _HD44780_DISPLAY | (flags & _HD44780_DISPLAY_MASK));
 }
 
-void lcd_cursor(__LCD_MULTIMODE_ONLY_INFO_ARG_WITH_COMMA(info) const uint8_t flags) {
+__LCD_API void lcd_cursor(__LCD_MULTIMODE_ONLY_INFO_ARG_WITH_COMMA(info) const uint8_t flags) {
+	#if LCD_HD44780_PIN_SHADOW
+		lcd_sync();
+	#endif
 	_lcd_command(__LCD_MULTIMODE_ONLY_VAR_WITH_COMMA(info) _HD44780_CURSOR | (flags & _HD44780_CURSOR_MASK));
+	#if __LCD_AC_TRACK
+		if (flag_is_clear(flags, __HD44780_SCN_BIT) && (_lcd_ac < __LCD_AC_CGRAM)) {
+			__LCD_AC_SET(__LCD_AC_UNKNOWN); // The cursor was moved
+		}
+	#endif
 }
 
-void lcd_func_set(__LCD_MULTIMODE_ONLY_INFO_ARG_WITH_COMMA(info) const uint8_t flags) {
+__LCD_API void lcd_func_set(__LCD_MULTIMODE_ONLY_INFO_ARG_WITH_COMMA(info) const uint8_t flags) {
 	_lcd_command(__LCD_MULTIMODE_ONLY_VAR_WITH_COMMA(info) _HD44780_FUNC | (flags & _HD44780_FUNC_MASK));
 }
 
-void lcd_cgr_adr(__LCD_MULTIMODE_ONLY_INFO_ARG_WITH_COMMA(info) const uint8_t flags) {
+__LCD_API void lcd_cgr_adr(__LCD_MULTIMODE_ONLY_INFO_ARG_WITH_COMMA(info) const uint8_t flags) {
 	_lcd_command(__LCD_MULTIMODE_ONLY_VAR_WITH_COMMA(info) _HD44780_CGRAM | (flags & _HD44780_CGRAM_MASK));
+	#if __LCD_AC_TRACK
+		__LCD_AC_SET(__LCD_AC_CGRAM);
+	#endif
+	#if __LCD_DUAL_E
+		_lcd_e = __LCD_E_BOTH; // The custom characters are loaded into both controllers
+	#endif
 }
 
-void lcd_ddr_adr(__LCD_MULTIMODE_ONLY_INFO_ARG_WITH_COMMA(info) const uint8_t flags) {
+__LCD_API void lcd_ddr_adr(__LCD_MULTIMODE_ONLY_INFO_ARG_WITH_COMMA(info) const uint8_t flags) {
+	#if LCD_HD44780_PIN_SHADOW
+		if (__LCD_AC_FOLLOW) {
+			_lcd_cur = flags & _HD44780_DDRAM_MASK; // Will be sent before the next changed cell
+			return;
+		}
+		_lcd_ac = _lcd_cur = __LCD_AC_UNKNOWN;
+	#elif __LCD_AC_TRACK_ONLY
+		if (__LCD_AC_FOLLOW) {
+			if ((flags & _HD44780_DDRAM_MASK) == _lcd_ac) {
+				return; // The increment has already moved the address counter there
+			}
+			_lcd_ac = flags & _HD44780_DDRAM_MASK;
+		}
+	#endif
+	#if __LCD_DUAL_E
+		if (_lcd_e == __LCD_E_BOTH) {
+			_lcd_select(__LCD_E1); // The rows 3 and 4 have the same addresses, see lcd_set_pos()
+		}
+	#endif
 	_lcd_command(__LCD_MULTIMODE_ONLY_VAR_WITH_COMMA(info) _HD44780_DDRAM | (flags & _HD44780_DDRAM_MASK));
 }
 
-void lcd_set_pos(__LCD_MULTIMODE_ONLY_INFO_ARG_WITH_COMMA(info) const lcd_line_t line, const uint8_t pos) {
+__LCD_API void lcd_set_pos(__LCD_MULTIMODE_ONLY_INFO_ARG_WITH_COMMA(info) const lcd_line_t line, const uint8_t pos) {
 	#if LCD_HD44780_PIN_MULTI_MODE
-	// TODO 40X4 support
-	switch(_info->row_cout) {
-		case 1:
-			lcd_ddr_adr(_info, __INFO_ROW_1_ADDR + pos);
-			return;
-		case 2:
-	#		pragma GCC diagnostic push
-	#		pragma GCC diagnostic ignored "-Wswitch"
-			switch(line) {
-				case LCD_ROW_1:
-					lcd_ddr_adr(_info, __INFO_ROW_1_ADDR + pos);
-					return;
-				case LCD_ROW_2:
-					lcd_ddr_adr(_info, __INFO_ROW_2_ADDR + pos);
-					return;
-			}
-	#		pragma GCC diagnostic pop
-			return;
-		case 4:
-			switch(line) {
-				case LCD_ROW_1:
-					lcd_ddr_adr(_info, __INFO_ROW_1_ADDR + pos);
-					return;
-				case LCD_ROW_2:
-					lcd_ddr_adr(_info, __INFO_ROW_2_ADDR + pos);
-					return;
-				case LCD_ROW_3:
-					lcd_ddr_adr(_info, __INFO_ROW_3_ADDR + pos);
-					return;
-				case LCD_ROW_4:
-					lcd_ddr_adr(_info, __INFO_ROW_4_ADDR + pos);
-					return;
-			}
-			return;
-	};
+	// The 40x4 display is not supported in multidisplay mode, see LCD_HD44780_PIN_INFO()
+	const uint8_t row_cout = _info->row_cout;
+	if (row_cout == 1) {
+		lcd_ddr_adr(_info, __INFO_ROW_1_ADDR + pos);
+	} else if ((uint8_t)line < row_cout) {
+		lcd_ddr_adr(_info, _info->row_addr[line] + pos);
+	}
 	#else
-	// TODO 40X4 support
+	#	if __LCD_DUAL_E
+			_lcd_select((line >= LCD_ROW_3) ? __LCD_E2 : __LCD_E1);
+	#	endif
 
 	#	if __INFO_ROW_COUT == 1
 			lcd_ddr_adr(__INFO_ROW_1_ADDR + pos);
@@ -552,7 +1268,185 @@ void lcd_set_pos(__LCD_MULTIMODE_ONLY_INFO_ARG_WITH_COMMA(info) const lcd_line_t
 	#endif
 }
 
-void lcd_line(__LCD_MULTIMODE_ONLY_INFO_ARG_WITH_COMMA(info) const char str[], const lcd_line_t line, const uint8_t start_pos) {
+/** \cond NO_DOC */
+#define __LCD_READ(_s, _i, _pgm)		((_pgm) ? pgm_read_byte(&(_s)[_i]) : (_s)[_i]) // The _P functions read the program memory
+/** \endcond */
+
+#if LCD_HD44780_PIN_UTF8
+#	if LCD_HD44780_PIN_UTF8 == HD44780_ROM_A00
+#		define __LCD_ROM(_a00, _a02)	(_a00)
+#	else
+#		define __LCD_ROM(_a00, _a02)	(_a02)
+#	endif
+
+// The ROM codes by the code point, 0 for the missing characters
+static const __flash byte_t _lcd_utf8_latin1[] = { // U+00A0-U+00FF
+	' ', __LCD_ROM('!', 0xA1), __LCD_ROM(0xEC, 0xA2), __LCD_ROM(0xED, 0xA3), __LCD_ROM(0, 0xA4), __LCD_ROM(0x5C, 0xA5), __LCD_ROM('|', 0xA6), __LCD_ROM(0, 0xA7),
+	0, __LCD_ROM(0, 0xA9), __LCD_ROM(0, 0xAA), __LCD_ROM(0, 0xAB), 0, '-', __LCD_ROM(0, 0xAE), 0,
+	__LCD_ROM(0xDF, 0xB0), __LCD_ROM(0, 0xB1), __LCD_ROM(0, 0xB2), __LCD_ROM(0, 0xB3), 0, __LCD_ROM(0xE4, 0xB5), __LCD_ROM(0, 0xB6), __LCD_ROM(0xA5, 0xB7),
+	0, __LCD_ROM(0, 0xB9), __LCD_ROM(0, 0xBA), __LCD_ROM(0, 0xBB), __LCD_ROM(0, 0xBC), __LCD_ROM(0, 0xBD), __LCD_ROM(0, 0xBE), __LCD_ROM(0, 0xBF),
+	__LCD_ROM('A', 0xC0), __LCD_ROM('A', 0xC1), __LCD_ROM('A', 0xC2), __LCD_ROM('A', 0xC3), __LCD_ROM(0xE1, 0xC4), __LCD_ROM('A', 0xC5), __LCD_ROM(0, 0xC6), __LCD_ROM('C', 0xC7),
+	__LCD_ROM('E', 0xC8), __LCD_ROM('E', 0xC9), __LCD_ROM('E', 0xCA), __LCD_ROM('E', 0xCB), __LCD_ROM('I', 0xCC), __LCD_ROM('I', 0xCD), __LCD_ROM('I', 0xCE), __LCD_ROM('I', 0xCF),
+	__LCD_ROM('D', 0xD0), __LCD_ROM(0xEE, 0xD1), __LCD_ROM('O', 0xD2), __LCD_ROM('O', 0xD3), __LCD_ROM('O', 0xD4), __LCD_ROM('O', 0xD5), __LCD_ROM(0xEF, 0xD6), __LCD_ROM('x', 0xD7),
+	__LCD_ROM('O', 0xD8), __LCD_ROM('U', 0xD9), __LCD_ROM('U', 0xDA), __LCD_ROM('U', 0xDB), __LCD_ROM(0xF5, 0xDC), __LCD_ROM('Y', 0xDD), __LCD_ROM(0, 0xDE), __LCD_ROM(0xE2, 0xDF),
+	__LCD_ROM('a', 0xE0), __LCD_ROM('a', 0xE1), __LCD_ROM('a', 0xE2), __LCD_ROM('a', 0xE3), __LCD_ROM(0xE1, 0xE4), __LCD_ROM('a', 0xE5), __LCD_ROM(0, 0xE6), __LCD_ROM('c', 0xE7),
+	__LCD_ROM('e', 0xE8), __LCD_ROM('e', 0xE9), __LCD_ROM('e', 0xEA), __LCD_ROM('e', 0xEB), __LCD_ROM('i', 0xEC), __LCD_ROM('i', 0xED), __LCD_ROM('i', 0xEE), __LCD_ROM('i', 0xEF),
+	__LCD_ROM(0, 0xF0), __LCD_ROM(0xEE, 0xF1), __LCD_ROM('o', 0xF2), __LCD_ROM('o', 0xF3), __LCD_ROM('o', 0xF4), __LCD_ROM('o', 0xF5), __LCD_ROM(0xEF, 0xF6), __LCD_ROM(0xFD, 0xF7),
+	__LCD_ROM('o', 0xF8), __LCD_ROM('u', 0xF9), __LCD_ROM('u', 0xFA), __LCD_ROM('u', 0xFB), __LCD_ROM(0xF5, 0xFC), __LCD_ROM('y', 0xFD), __LCD_ROM(0, 0xFE), __LCD_ROM('y', 0xFF),
+};
+
+static const __flash byte_t _lcd_utf8_greek[] = { // U+0390-U+03CF
+	0, 'A', 'B', __LCD_ROM(0, 0x92), 0, 'E', 'Z', 'H', __LCD_ROM(0xF2, 0x99), 'I', 'K', 0, 'M', 'N', 0, 'O',
+	__LCD_ROM(0, 0x87), 'P', 0, __LCD_ROM(0xF6, 0x94), 'T', 'Y', 0, 'X', 0, __LCD_ROM(0xF4, 0x9A), 0, 0, 0, 0, 0, 0,
+	0, __LCD_ROM(0xE0, 0x90), __LCD_ROM(0xE2, 0), 0, __LCD_ROM(0, 0x9B), __LCD_ROM(0xE3, 0x9E), 0, 0, __LCD_ROM(0xF2, 0x99), 0, 'k', 0, __LCD_ROM(0xE4, 0xB5), 'v', 0, 'o',
+	__LCD_ROM(0xF7, 0x93), __LCD_ROM(0xE6, 'p'), 0, __LCD_ROM(0xE5, 0x95), __LCD_ROM(0, 0x97), 'u', 0, 0, 0, __LCD_ROM(0, 0xB8), 0, 0, 0, 0, 0, 0,
+};
+
+// The lowercase letters missing in A02 are shown by the uppercase ones, A00 has only the Latin look-alikes
+static const __flash byte_t _lcd_utf8_cyrillic[] = { // U+0400-U+045F
+	__LCD_ROM('E', 0xC8), __LCD_ROM('E', 0xCB), 0, 0, 0, 'S', 'I', __LCD_ROM('I', 0xCF), 'J', 0, 0, 0, 0, 0, 0, 0,
+	'A', __LCD_ROM(0, 0x80), 'B', __LCD_ROM(0, 0x92), __LCD_ROM(0, 0x81), 'E', __LCD_ROM(0, 0x82), __LCD_ROM('3', 0x83),
+	__LCD_ROM(0, 0x84), __LCD_ROM(0, 0x85), 'K', __LCD_ROM(0, 0x86), 'M', 'H', 'O', __LCD_ROM(0, 0x87),
+	'P', 'C', 'T', __LCD_ROM('Y', 0x88), 0, 'X', __LCD_ROM(0, 0x89), __LCD_ROM(0, 0x8A),
+	__LCD_ROM(0, 0x8B), __LCD_ROM(0, 0x8C), __LCD_ROM(0, 0x8D), __LCD_ROM(0, 0x8E), 'b', __LCD_ROM(0, 0x8F), __LCD_ROM(0, 0xAC), __LCD_ROM(0, 0xAD),
+	'a', __LCD_ROM('6', 0x80), 'B', __LCD_ROM(0, 0x92), __LCD_ROM(0, 0x81), 'e', __LCD_ROM(0, 0x82), __LCD_ROM('3', 0x83),
+	__LCD_ROM(0, 0x84), __LCD_ROM(0, 0x85), 'K', __LCD_ROM(0, 0x86), 'M', 'H', 'o', __LCD_ROM(0, 0x87),
+	'p', 'c', 'T', 'y', 0, 'x', __LCD_ROM(0, 0x89), __LCD_ROM(0, 0x8A),
+	__LCD_ROM(0, 0x8B), __LCD_ROM(0, 0x8C), __LCD_ROM(0, 0x8D), __LCD_ROM(0, 0x8E), 'b', __LCD_ROM(0, 0x8F), __LCD_ROM(0, 0xAC), __LCD_ROM(0, 0xAD),
+	__LCD_ROM('e', 0xE8), __LCD_ROM('e', 0xEB), 0, 0, 0, 's', 'i', __LCD_ROM('i', 0xEF), 'j', 0, 0, 0, 0, 0, 0, 0,
+};
+
+// The symbols out of the blocks above
+static byte_t _lcd_utf8_symbol(const uint16_t cp) {
+	switch (cp) {
+		case 0x0192: return __LCD_ROM(0, 0xA8); // Florin
+		case 0x2013:
+		case 0x2014: return '-'; // Dashes
+		case 0x2016: return __LCD_ROM(0, 0xA0); // Double vertical line
+		case 0x2018: return __LCD_ROM('\'', 0xAF);
+		case 0x2019: return '\'';
+		case 0x201C: return __LCD_ROM('"', 0x12);
+		case 0x201D: return __LCD_ROM('"', 0x13);
+		case 0x2022: return __LCD_ROM(0xA5, 0x16); // Bullet
+		case 0x2190: return __LCD_ROM(0x7F, 0x1B); // Arrows
+		case 0x2191: return __LCD_ROM(0, 0x18);
+		case 0x2192: return __LCD_ROM(0x7E, 0x1A);
+		case 0x2193: return __LCD_ROM(0, 0x19);
+		case 0x221A: return __LCD_ROM(0xE8, 0); // Square root
+		case 0x221E: return __LCD_ROM(0xF3, 0x9C); // Infinity
+		case 0x2229: return __LCD_ROM(0, 0x9F); // Intersection
+		case 0x2264: return __LCD_ROM(0, 0x1C);
+		case 0x2265: return __LCD_ROM(0, 0x1D);
+		case 0x2588: return __LCD_ROM(0xFF, 0); // Full block
+		case 0x25B2: return __LCD_ROM(0, 0x1E); // Triangles
+		case 0x25B6: return __LCD_ROM(0, 0x10);
+		case 0x25BC: return __LCD_ROM(0, 0x1F);
+		case 0x25C0: return __LCD_ROM(0, 0x11);
+		case 0x25CF: return __LCD_ROM(0, 0x16); // Black circle
+		case 0x2665: return __LCD_ROM(0, 0x9D); // Heart
+		case 0x266A: return __LCD_ROM(0, 0x91); // Note
+	#	if LCD_HD44780_PIN_UTF8 == HD44780_ROM_A00
+		case 0x3001: return 0xA4; // Japanese punctuation
+		case 0x3002: return 0xA1;
+		case 0x300C: return 0xA2;
+		case 0x300D: return 0xA3;
+		case 0x30FB: return 0xA5;
+		case 0x30FC: return 0xB0;
+		case 0x4E07: return 0xFB; // Ten thousand
+		case 0x5186: return 0xFC; // Yen
+		case 0x5343: return 0xFA; // Thousand
+	#	endif
+		default: return 0;
+	}
+}
+
+#	if LCD_HD44780_PIN_GLYPH_CACHE
+static const __flash lcd_utf8_glyph_t *_lcd_utf8_glyph_table = NULL;
+static uint8_t _lcd_utf8_glyph_count = 0;
+
+void lcd_utf8_glyphs(const __flash lcd_utf8_glyph_t glyphs[], const uint8_t count) {
+	_lcd_utf8_glyph_table = glyphs;
+	_lcd_utf8_glyph_count = glyphs ? count : 0;
+}
+#	endif
+
+static byte_t _lcd_utf8_missing(const uint16_t cp) {
+	#if LCD_HD44780_PIN_GLYPH_CACHE
+		for (uint8_t i = 0; i < _lcd_utf8_glyph_count; i++) {
+			if (_lcd_utf8_glyph_table[i].code_point == cp) {
+				const byte_t slot = lcd_glyph(_lcd_utf8_glyph_table[i].glyph);
+				if (slot != LCD_GLYPH_NONE) {
+					return slot | 0x08; // The codes 8-15 show the same slots, so 0 can't end the string
+				}
+				break;
+			}
+		}
+	#else
+		(void)cp;
+	#endif
+	return LCD_HD44780_PIN_UTF8_MISSING;
+}
+
+static byte_t _lcd_utf8_map(const uint16_t cp) {
+	byte_t code;
+	if ((cp >= 0x00A0) && (cp < 0x0100)) {
+		code = _lcd_utf8_latin1[cp - 0x00A0];
+	} else if ((cp >= 0x0390) && (cp < 0x03D0)) {
+		code = _lcd_utf8_greek[cp - 0x0390];
+	} else if ((cp >= 0x0400) && (cp < 0x0460)) {
+		code = _lcd_utf8_cyrillic[cp - 0x0400];
+	#	if LCD_HD44780_PIN_UTF8 == HD44780_ROM_A00
+	} else if ((cp >= 0xFF61) && (cp < 0xFFA0)) {
+		code = cp - 0xFF61 + 0xA1; // Halfwidth katakana are in the ROM order
+	#	endif
+	} else {
+		code = _lcd_utf8_symbol(cp);
+	}
+	return code ? code : _lcd_utf8_missing(cp);
+}
+
+// Decodes the symbol at pos and leaves pos at its last byte
+__LCD_STATIC byte_t _lcd_utf8_next(const char str[], uint8_t *const pos, const bool is_pgm) {
+	const byte_t lead = __LCD_READ(str, *pos, is_pgm);
+	if (lead < 0x80) {
+		return lead;
+	}
+	uint8_t more;
+	uint16_t cp;
+	if ((lead & 0xE0) == 0xC0) {
+		more = 1;
+		cp = lead & 0x1F;
+	} else if ((lead & 0xF0) == 0xE0) {
+		more = 2;
+		cp = lead & 0x0F;
+	} else if ((lead & 0xF8) == 0xF0) {
+		more = 3; // Beyond U+FFFF, never in the ROM
+		cp = 0;
+	} else {
+		return LCD_HD44780_PIN_UTF8_MISSING; // A continuation byte without the lead one
+	}
+	const bool in_bmp = more < 3;
+	for (; more; more--) {
+		const byte_t next = __LCD_READ(str, *pos + 1, is_pgm);
+		if ((next & 0xC0) != 0x80) {
+			return LCD_HD44780_PIN_UTF8_MISSING; // A cut sequence, the next byte starts the next symbol
+		}
+		(*pos)++;
+		cp = (cp << 6) | (next & 0x3F);
+	}
+	return in_bmp ? _lcd_utf8_map(cp) : LCD_HD44780_PIN_UTF8_MISSING;
+}
+
+/** \cond NO_DOC */
+#	define __LCD_NEXT(_s, _i, _pgm)		_lcd_utf8_next((_s), &(_i), (_pgm)) // A UTF-8 sequence gives one symbol, _i is left at its last byte
+/** \endcond */
+#else
+/** \cond NO_DOC */
+#	define __LCD_NEXT(_s, _i, _pgm)		__LCD_READ(_s, _i, _pgm)
+/** \endcond */
+#endif // LCD_HD44780_PIN_UTF8
+
+__LCD_STATIC void _lcd_line_any(__LCD_MULTIMODE_ONLY_INFO_ARG_WITH_COMMA(info) const char str[], const bool is_pgm, const lcd_line_t line, const uint8_t start_pos) {
 	lcd_set_pos(__LCD_MULTIMODE_ONLY_VAR_WITH_COMMA(info) line, 0);
 	uint8_t fill_pos = start_pos;
 	uint8_t spring_pos = 0;
@@ -561,26 +1455,49 @@ void lcd_line(__LCD_MULTIMODE_ONLY_INFO_ARG_WITH_COMMA(info) const char str[], c
 			lcd_byte(__LCD_MULTIMODE_ONLY_VAR_WITH_COMMA(info) ' ');
 			fill_pos--;
 		} else {
-			if (str[spring_pos] != '\0') {
-				lcd_byte(__LCD_MULTIMODE_ONLY_VAR_WITH_COMMA(info) str[spring_pos]);
+			const char ch = __LCD_NEXT(str, spring_pos, is_pgm);
+			if (ch != '\0') {
+				lcd_byte(__LCD_MULTIMODE_ONLY_VAR_WITH_COMMA(info) ch);
 				spring_pos++;
 			} else {
 				lcd_byte(__LCD_MULTIMODE_ONLY_VAR_WITH_COMMA(info) ' ');
 			}
 		}
 	}
+	#if LCD_HD44780_PIN_SHADOW
+		if (__LCD_AC_FOLLOW) {
+			_lcd_shadow_dirty &= ~_BV(line); // The whole row is up to date now
+		}
+	#endif
 }
 
-void lcd_print(__LCD_MULTIMODE_ONLY_INFO_ARG_WITH_COMMA(info) const char str[]) {
-	for(uint8_t pos = 0; str[pos] != '\0'; pos++) {
-		if (str[pos] == '\n') {
+__LCD_API void lcd_line(__LCD_MULTIMODE_ONLY_INFO_ARG_WITH_COMMA(info) const char str[], const lcd_line_t line, const uint8_t start_pos) {
+	_lcd_line_any(__LCD_MULTIMODE_ONLY_VAR_WITH_COMMA(info) str, false, line, start_pos);
+}
+
+__LCD_API void lcd_line_P(__LCD_MULTIMODE_ONLY_INFO_ARG_WITH_COMMA(info) const char str[], const lcd_line_t line, const uint8_t start_pos) {
+	_lcd_line_any(__LCD_MULTIMODE_ONLY_VAR_WITH_COMMA(info) str, true, line, start_pos);
+}
+
+__LCD_STATIC void _lcd_print_any(__LCD_MULTIMODE_ONLY_INFO_ARG_WITH_COMMA(info) const char str[], const bool is_pgm) {
+	char ch;
+	for(uint8_t pos = 0; (ch = __LCD_NEXT(str, pos, is_pgm)) != '\0'; pos++) {
+		if (ch == '\n') {
 			continue;
 		}
-		lcd_byte(__LCD_MULTIMODE_ONLY_VAR_WITH_COMMA(info) str[pos]);
+		lcd_byte(__LCD_MULTIMODE_ONLY_VAR_WITH_COMMA(info) ch);
 	}
 }
 
-bool _go_next_line(__LCD_MULTIMODE_ONLY_INFO_ARG_WITH_COMMA(info) lcd_line_t* line, byte_t* line_remnant) {
+__LCD_API void lcd_print(__LCD_MULTIMODE_ONLY_INFO_ARG_WITH_COMMA(info) const char str[]) {
+	_lcd_print_any(__LCD_MULTIMODE_ONLY_VAR_WITH_COMMA(info) str, false);
+}
+
+__LCD_API void lcd_print_P(__LCD_MULTIMODE_ONLY_INFO_ARG_WITH_COMMA(info) const char str[]) {
+	_lcd_print_any(__LCD_MULTIMODE_ONLY_VAR_WITH_COMMA(info) str, true);
+}
+
+__LCD_STATIC bool _go_next_line(__LCD_MULTIMODE_ONLY_INFO_ARG_WITH_COMMA(info) lcd_line_t* line, byte_t* line_remnant) {
 	*line_remnant = __INFO_COL_COUT;
 	switch(*line) {
 		case LCD_ROW_1:
@@ -601,13 +1518,53 @@ bool _go_next_line(__LCD_MULTIMODE_ONLY_INFO_ARG_WITH_COMMA(info) lcd_line_t* li
 	return true;
 }
 
-void lcd_refresh_ml(__LCD_MULTIMODE_ONLY_INFO_ARG_WITH_COMMA(info) const char str[]) {
+#if __LCD_DUAL_E && !LCD_HD44780_PIN_UTF8
+// The controllers are written in turn, so each one executes while the other one receives the next symbol
+static void _lcd_refresh_dual(const char str[], const bool is_pgm) {
+	const char *row_str[__INFO_ROW_COUT];
+	byte_t row_len[__INFO_ROW_COUT];
+	for (byte_t row = 0; row < __INFO_ROW_COUT; row++) {
+		byte_t len = 0;
+		char ch;
+		while ((len < __INFO_COL_COUT) && ((ch = __LCD_READ(str, len, is_pgm)) != '\0') && (ch != '\n')) {
+			len++;
+		}
+		row_str[row] = str;
+		row_len[row] = len;
+		str += len;
+		if ((len < __INFO_COL_COUT) && (__LCD_READ(str, 0, is_pgm) == '\n')) {
+			str++; // A line break right after a full row gives an empty row, as lcd_refresh_ml() does
+		}
+	}
+	for (byte_t row = LCD_ROW_1; row <= LCD_ROW_2; row++) {
+		lcd_set_pos(row, 0);
+		lcd_set_pos(row + LCD_ROW_3, 0);
+		for (byte_t col = 0; col < __INFO_COL_COUT; col++) {
+			_lcd_e = __LCD_E1;
+			lcd_byte((col < row_len[row]) ? __LCD_READ(row_str[row], col, is_pgm) : ' ');
+			_lcd_e = __LCD_E2;
+			lcd_byte((col < row_len[row + LCD_ROW_3]) ? __LCD_READ(row_str[row + LCD_ROW_3], col, is_pgm) : ' ');
+		}
+	}
+}
+#endif // __LCD_DUAL_E && !LCD_HD44780_PIN_UTF8
+
+__LCD_STATIC void _lcd_refresh_ml_any(__LCD_MULTIMODE_ONLY_INFO_ARG_WITH_COMMA(info) const char str[], const bool is_pgm) {
+	#if __LCD_DUAL_E && !LCD_HD44780_PIN_UTF8
+		_lcd_refresh_dual(str, is_pgm);
+		return;
+	#endif
 	byte_t max_count = __INFO_ROW_COUT * __INFO_COL_COUT;
 	lcd_line_t line = LCD_ROW_1;
-	lcd_ddr_adr(__LCD_MULTIMODE_ONLY_VAR_WITH_COMMA(info) __INFO_ROW_1_ADDR); // It's faster, then lcd_set_pos([info,] line, 0)
+	#if __LCD_DUAL_E
+		lcd_set_pos(line, 0); // Selects the controller, the UTF-8 rows are not split in advance
+	#else
+		lcd_ddr_adr(__LCD_MULTIMODE_ONLY_VAR_WITH_COMMA(info) __INFO_ROW_1_ADDR); // It's faster, then lcd_set_pos([info,] line, 0)
+	#endif
 	byte_t counter = max_count;
 	byte_t line_remnant = __INFO_COL_COUT;
-	for(uint8_t pos = 0; counter && str[pos] != '\0'; pos++) {
+	char ch;
+	for(uint8_t pos = 0; counter && (ch = __LCD_NEXT(str, pos, is_pgm)) != '\0'; pos++) {
 		if (!max_count) {
 			break;
 		}
@@ -616,8 +1573,9 @@ void lcd_refresh_ml(__LCD_MULTIMODE_ONLY_INFO_ARG_WITH_COMMA(info) const char st
 				lcd_set_pos(__LCD_MULTIMODE_ONLY_VAR_WITH_COMMA(info) line, 0);
 				break;
 			}
+			lcd_set_pos(__LCD_MULTIMODE_ONLY_VAR_WITH_COMMA(info) line, 0); // The rows are not contiguous in DDRAM
 		}
-		if (str[pos] == '\n') {
+		if (ch == '\n') {
 			for (; line_remnant; line_remnant--) {
 				lcd_byte(__LCD_MULTIMODE_ONLY_VAR_WITH_COMMA(info) ' ');
 				counter--;
@@ -626,9 +1584,10 @@ void lcd_refresh_ml(__LCD_MULTIMODE_ONLY_INFO_ARG_WITH_COMMA(info) const char st
 				lcd_set_pos(__LCD_MULTIMODE_ONLY_VAR_WITH_COMMA(info) line, 0);
 				break;
 			}
+			lcd_set_pos(__LCD_MULTIMODE_ONLY_VAR_WITH_COMMA(info) line, 0); // The rows are not contiguous in DDRAM
 			continue;
 		}
-		lcd_byte(__LCD_MULTIMODE_ONLY_VAR_WITH_COMMA(info) str[pos]);
+		lcd_byte(__LCD_MULTIMODE_ONLY_VAR_WITH_COMMA(info) ch);
 		counter--;
 		line_remnant--;
 	}
@@ -639,17 +1598,63 @@ void lcd_refresh_ml(__LCD_MULTIMODE_ONLY_INFO_ARG_WITH_COMMA(info) const char st
 	while (_go_next_line(__LCD_MULTIMODE_ONLY_VAR_WITH_COMMA(info) &line, &line_remnant)) {
 		lcd_line(__LCD_MULTIMODE_ONLY_VAR_WITH_COMMA(info) "", line, 0);
 	}
+	#if LCD_HD44780_PIN_SHADOW
+		if (__LCD_AC_FOLLOW) {
+			_lcd_shadow_dirty = 0;
+		}
+	#endif
+}
+
+__LCD_API void lcd_refresh_ml(__LCD_MULTIMODE_ONLY_INFO_ARG_WITH_COMMA(info) const char str[]) {
+	_lcd_refresh_ml_any(__LCD_MULTIMODE_ONLY_VAR_WITH_COMMA(info) str, false);
+}
+
+__LCD_API void lcd_refresh_ml_P(__LCD_MULTIMODE_ONLY_INFO_ARG_WITH_COMMA(info) const char str[]) {
+	_lcd_refresh_ml_any(__LCD_MULTIMODE_ONLY_VAR_WITH_COMMA(info) str, true);
+}
+
+#if LCD_HD44780_PIN_DUAL_NIBBLE
+void lcd_pair_byte(const byte_t ch1, const byte_t ch2) {
+	#if __LCD_WAIT_DEFERRED
+		_lcd_wait_ready();
+	#endif
+	_lcd_pair_send((ch1 >> 4) | (ch2 & 0xF0));
+	_lcd_pair_send((ch1 & _HD44780_HALF_DATA_MASK) | (ch2 << 4));
+	_lcd_exec_wait(__LCD_EXEC_DATA);
+	#if __LCD_AC_TRACK_ONLY
+		_lcd_ac_step();
+	#endif
+}
+
+void lcd_pair_line(const char str1[], const char str2[], const lcd_line_t line, const uint8_t start_pos) {
+	lcd_set_pos(line, 0);
+	uint8_t spring_pos1 = 0;
+	uint8_t spring_pos2 = 0;
+	for(uint8_t pos = 0; pos < __INFO_COL_COUT; pos++) {
+		byte_t ch1 = ' ';
+		byte_t ch2 = ' ';
+		if (pos >= start_pos) {
+			if (str1[spring_pos1] != '\0') {
+				ch1 = str1[spring_pos1++];
+			}
+			if (str2[spring_pos2] != '\0') {
+				ch2 = str2[spring_pos2++];
+			}
+		}
+		lcd_pair_byte(ch1, ch2);
+	}
 }
+#endif // LCD_HD44780_PIN_DUAL_NIBBLE
 
 #if LCD_HD44780_PIN_MULTI_MODE || LCD_HD44780_PIN_ALLOW_RW
-static byte_t _lcd_read_byte(
+__LCD_STATIC byte_t _lcd_read_byte(
 						__LCD_MULTIMODE_ONLY_INFO_ARG_WITH_COMMA(info)
 						__LCD_MULTIMODE_ONLY_BOOL_ARG(is_8bit)
 					) {
 	#if LCD_HD44780_PIN_MULTI_MODE
 		pin_on(*(_info->e_port), _info->e_pin);
 	#else
-		PIN_ON(LCD_HD44780_PIN_E_PORT, LCD_HD44780_PIN_E_PIN);
+		__LCD_E_ON();
 	#endif
 	_delay_us(HD44780_ENABLE_PULSE_US);
 	byte_t rdata;
@@ -670,10 +1675,10 @@ static byte_t _lcd_read_byte(
 			rdata = READ_BYTE(LCD_HD44780_PIN_DATA_PORT);
 	#	else
 			rdata = (PORT_READ(LCD_HD44780_PIN_DATA_PORT, __INFO_PORT_MASK) >> __INFO_DATA_SHIFT) << 4; // read upper nibble
-			PIN_OFF(LCD_HD44780_PIN_E_PORT, LCD_HD44780_PIN_E_PIN);
+			__LCD_E_OFF();
 			_delay_us(HD44780_ENABLE_PULSE_US);
 
-			PIN_ON(LCD_HD44780_PIN_E_PORT, LCD_HD44780_PIN_E_PIN);
+			__LCD_E_ON();
 			_delay_us(HD44780_ENABLE_PULSE_US);
 			rdata |= PORT_READ(LCD_HD44780_PIN_DATA_PORT, __INFO_PORT_MASK) >> __INFO_DATA_SHIFT; //read lower nibble
 	#	endif
@@ -681,13 +1686,13 @@ static byte_t _lcd_read_byte(
 	#if LCD_HD44780_PIN_MULTI_MODE
 		pin_off(*(_info->e_port), _info->e_pin);
 	#else
-		PIN_OFF(LCD_HD44780_PIN_E_PORT, LCD_HD44780_PIN_E_PIN);
+		__LCD_E_OFF();
 	#endif
 	_delay_us(HD44780_ENABLE_PULSE_US);
 	return rdata;
 }
 
-byte_t lcd_read_busy_and_addr(__LCD_MULTIMODE_ONLY_INFO_ARG(info)) {
+__LCD_STATIC byte_t _lcd_read_busy_and_addr(__LCD_MULTIMODE_ONLY_INFO_ARG(info)) {
 	#if LCD_HD44780_PIN_MULTI_MODE
 		port_to_read_pu(*(_info->data_ddr), *(_info->data_port), _info->port_mask);
 		pin_off(*(_info->rs_port), _info->rs_pin);
@@ -695,6 +1700,9 @@ byte_t lcd_read_busy_and_addr(__LCD_MULTIMODE_ONLY_INFO_ARG(info)) {
 
 		bool _is_8bit = flag_is_set(_info->flags, __HD44780_CONF_IDL_BIT);
 	#else
+	#	if LCD_HD44780_PIN_ASYNC
+			lcd_flush();
+	#	endif
 		PORT_TO_READ_PU(LCD_HD44780_PIN_DATA_PORT, __INFO_PORT_MASK);
 		PIN_OFF(LCD_HD44780_PIN_RS_PORT, LCD_HD44780_PIN_RS_PIN);
 		PIN_ON(LCD_HD44780_PIN_RW_PORT, LCD_HD44780_PIN_RW_PIN);
@@ -719,11 +1727,23 @@ byte_t lcd_read_busy_and_addr(__LCD_MULTIMODE_ONLY_INFO_ARG(info)) {
 		PIN_OFF(LCD_HD44780_PIN_RW_PORT, LCD_HD44780_PIN_RW_PIN);
 		PORT_TO_WRITE(LCD_HD44780_PIN_DATA_PORT, __INFO_PORT_MASK);
 		PIN_ON(LCD_HD44780_PIN_RS_PORT, LCD_HD44780_PIN_RS_PIN);// Default on - data
+	#	if __LCD_BF_DEFERRED && __LCD_DUAL_E
+		_lcd_busy &= ~_lcd_bus;
+	#	elif __LCD_BF_DEFERRED
+		_lcd_busy = false;
+	#	endif
 	#endif
 	return rdata & _HD44780_ADDR_MASK;
 }
 
-byte_t lcd_read_data(__LCD_MULTIMODE_ONLY_INFO_ARG(info)) {
+__LCD_API byte_t lcd_read_busy_and_addr(__LCD_MULTIMODE_ONLY_INFO_ARG(info)) {
+	#if __LCD_DUAL_E
+		_lcd_bus = __LCD_E_READ;
+	#endif
+	return _lcd_read_busy_and_addr(__LCD_MULTIMODE_ONLY_VAR(info));
+}
+
+__LCD_API byte_t lcd_read_data(__LCD_MULTIMODE_ONLY_INFO_ARG(info)) {
 	#if LCD_HD44780_PIN_MULTI_MODE
 	port_to_read_pu(*(_info->data_ddr), *(_info->data_port), _info->port_mask);
 	pin_on(*(_info->rw_port), _info->rw_pin);
@@ -733,6 +1753,18 @@ byte_t lcd_read_data(__LCD_MULTIMODE_ONLY_INFO_ARG(info)) {
 	pin_off(*(_info->rw_port), _info->rw_pin);
 	port_to_write(*(_info->data_ddr), _info->port_mask);
 	#else
+	#	if LCD_HD44780_PIN_SHADOW
+		lcd_sync();
+	#	endif
+	#	if LCD_HD44780_PIN_ASYNC
+		lcd_flush();
+	#	endif
+	#	if __LCD_DUAL_E
+		_lcd_bus = __LCD_E_READ;
+	#	endif
+	#	if __LCD_WAIT_DEFERRED
+		_lcd_wait_ready();
+	#	endif
 	PORT_TO_READ_PU(LCD_HD44780_PIN_DATA_PORT, __INFO_PORT_MASK);
 	PIN_ON(LCD_HD44780_PIN_RW_PORT, LCD_HD44780_PIN_RW_PIN);
 
@@ -740,7 +1772,428 @@ byte_t lcd_read_data(__LCD_MULTIMODE_ONLY_INFO_ARG(info)) {
 
 	PIN_OFF(LCD_HD44780_PIN_RW_PORT, LCD_HD44780_PIN_RW_PIN);
 	PORT_TO_WRITE(LCD_HD44780_PIN_DATA_PORT, __INFO_PORT_MASK);
+	#	if __LCD_AC_TRACK
+		if (_lcd_ac < __LCD_AC_CGRAM) {
+			__LCD_AC_SET(_lcd_addr_next(_lcd_ac)); // Reading also moves the address counter
+		}
+	#	endif
 	#endif
 	return rdata;
 }
 #endif // Read
+
+#if LCD_HD44780_PIN_MULTI_MODE || (LCD_HD44780_PIN_ALLOW_RW && !(LCD_HD44780_PIN_SHADOW || LCD_HD44780_PIN_ASYNC || __LCD_DUAL_E || __LCD_TIMER_WAIT))
+// The symbols go back to back with RS high, RS is lowered only to poll the busy flag before the next one
+__LCD_STATIC void _lcd_write_run(__LCD_MULTIMODE_ONLY_INFO_ARG_WITH_COMMA(info) const byte_t buf[], const bool is_pgm, const uint8_t len) {
+	#if __LCD_WAIT_DEFERRED
+		_lcd_wait_ready();
+	#endif
+	byte_t ch = __LCD_READ(buf, 0, is_pgm);
+	for (uint8_t i = 1; ; i++) {
+		_lcd_byte(__LCD_MULTIMODE_ONLY_VAR_WITH_COMMA(info) ch);
+		if (i == len) {
+			break;
+		}
+		ch = __LCD_READ(buf, i, is_pgm); // Fetched while the controller executes
+		_lcd_read_busy_and_addr(__LCD_MULTIMODE_ONLY_VAR(info));
+	}
+	_lcd_exec_wait(__LCD_MULTIMODE_ONLY_VAR_WITH_COMMA(info) __LCD_EXEC_DATA); // Only marks the last one as busy in the deferred wait mode
+}
+#	define __LCD_WRITE_RUN		1
+#endif
+
+__LCD_STATIC void _lcd_write_block_any(__LCD_MULTIMODE_ONLY_INFO_ARG_WITH_COMMA(info) const byte_t buf[], const bool is_pgm, const uint8_t len) {
+	if (!len) {
+		return;
+	}
+	#if LCD_HD44780_PIN_MULTI_MODE
+		if (__LCD_INFO_CAN_READ(_info)) {
+			_lcd_write_run(_info, buf, is_pgm, len);
+			return;
+		}
+	#elif __LCD_WRITE_RUN
+		_lcd_write_run(buf, is_pgm, len);
+	#	if __LCD_AC_TRACK_ONLY
+		for (uint8_t i = 0; i < len; i++) {
+			_lcd_ac_step();
+		}
+	#	endif
+		return;
+	#endif
+	for (uint8_t i = 0; i < len; i++) {
+		lcd_byte(__LCD_MULTIMODE_ONLY_VAR_WITH_COMMA(info) __LCD_READ(buf, i, is_pgm));
+	}
+}
+
+__LCD_API void lcd_write_block(__LCD_MULTIMODE_ONLY_INFO_ARG_WITH_COMMA(info) const byte_t buf[], const uint8_t len) {
+	_lcd_write_block_any(__LCD_MULTIMODE_ONLY_VAR_WITH_COMMA(info) buf, false, len);
+}
+
+__LCD_API void lcd_write_block_P(__LCD_MULTIMODE_ONLY_INFO_ARG_WITH_COMMA(info) const __flash byte_t buf[], const uint8_t len) {
+	_lcd_write_block_any(__LCD_MULTIMODE_ONLY_VAR_WITH_COMMA(info) (const byte_t *)buf, true, len); // Only the address is passed on, it is read by pgm_read_byte()
+}
+
+__LCD_API void lcd_write_at(__LCD_MULTIMODE_ONLY_INFO_ARG_WITH_COMMA(info) const lcd_line_t line, const uint8_t pos, const byte_t buf[], const uint8_t len) {
+	lcd_set_pos(__LCD_MULTIMODE_ONLY_VAR_WITH_COMMA(info) line, pos);
+	lcd_write_block(__LCD_MULTIMODE_ONLY_VAR_WITH_COMMA(info) buf, len);
+}
+
+static const __flash uint32_t _lcd_pow10[] = {1000000000UL, 100000000UL, 10000000UL, 1000000UL, 100000UL, 10000UL, 1000UL, 100UL, 10UL};
+#define __LCD_POW10(_k)		_lcd_pow10[sizeof(_lcd_pow10) / sizeof(_lcd_pow10[0]) - (_k)] // 10^k, k = 1-9
+
+// The digits go from the most significant one by subtracting the powers of ten, so there are no divisions and no string buffer
+__LCD_STATIC void _lcd_put_num(__LCD_MULTIMODE_ONLY_INFO_ARG_WITH_COMMA(info) uint32_t value, const bool neg, const uint8_t frac_digits, const uint8_t width, const char pad) {
+	uint8_t digits = 1;
+	while ((digits < 10) && (value >= __LCD_POW10(digits))) {
+		digits++;
+	}
+	if (digits <= frac_digits) {
+		digits = frac_digits + 1; // A leading zero before the point
+	}
+	uint8_t len = digits + (neg ? 1 : 0) + (frac_digits ? 1 : 0);
+	if (neg && (pad == '0')) {
+		lcd_byte(__LCD_MULTIMODE_ONLY_VAR_WITH_COMMA(info) '-'); // The sign goes before the zeros
+	}
+	for (; len < width; len++) {
+		lcd_byte(__LCD_MULTIMODE_ONLY_VAR_WITH_COMMA(info) pad);
+	}
+	if (neg && (pad != '0')) {
+		lcd_byte(__LCD_MULTIMODE_ONLY_VAR_WITH_COMMA(info) '-');
+	}
+	for (uint8_t k = digits - 1; k != 0; k--) {
+		const uint32_t pow = __LCD_POW10(k);
+		char ch = '0';
+		while (value >= pow) {
+			value -= pow;
+			ch++;
+		}
+		lcd_byte(__LCD_MULTIMODE_ONLY_VAR_WITH_COMMA(info) ch);
+		if (k == frac_digits) {
+			lcd_byte(__LCD_MULTIMODE_ONLY_VAR_WITH_COMMA(info) '.');
+		}
+	}
+	lcd_byte(__LCD_MULTIMODE_ONLY_VAR_WITH_COMMA(info) '0' + (byte_t)value);
+}
+
+__LCD_API void lcd_put_u16(__LCD_MULTIMODE_ONLY_INFO_ARG_WITH_COMMA(info) const uint16_t value, const uint8_t width, const char pad) {
+	_lcd_put_num(__LCD_MULTIMODE_ONLY_VAR_WITH_COMMA(info) value, false, 0, width, pad);
+}
+
+__LCD_API void lcd_put_u32(__LCD_MULTIMODE_ONLY_INFO_ARG_WITH_COMMA(info) const uint32_t value, const uint8_t width, const char pad) {
+	_lcd_put_num(__LCD_MULTIMODE_ONLY_VAR_WITH_COMMA(info) value, false, 0, width, pad);
+}
+
+__LCD_API void lcd_put_fixed(__LCD_MULTIMODE_ONLY_INFO_ARG_WITH_COMMA(info) const int32_t value, const uint8_t frac_digits, const uint8_t width, const char pad) {
+	const bool neg = value < 0;
+	const uint32_t abs_value = neg ? -(uint32_t)value : (uint32_t)value; // INT32_MIN has no positive counterpart
+	_lcd_put_num(__LCD_MULTIMODE_ONLY_VAR_WITH_COMMA(info) abs_value, neg, (frac_digits > 9) ? 9 : frac_digits, width, pad);
+}
+
+__LCD_API void lcd_put_i32(__LCD_MULTIMODE_ONLY_INFO_ARG_WITH_COMMA(info) const int32_t value, const uint8_t width, const char pad) {
+	lcd_put_fixed(__LCD_MULTIMODE_ONLY_VAR_WITH_COMMA(info) value, 0, width, pad);
+}
+
+#if LCD_HD44780_PIN_MULTI_MODE
+#	undef lcd_clear
+#	undef lcd_home
+#	undef lcd_entry_mode
+#	undef lcd_display_ctrl
+#	undef lcd_cursor
+#	undef lcd_func_set
+#	undef lcd_cgr_adr
+#	undef lcd_ddr_adr
+#	undef lcd_set_pos
+#	undef lcd_byte
+#	undef lcd_line
+#	undef lcd_print
+#	undef lcd_refresh_ml
+#	undef lcd_write_block
+#	undef lcd_write_at
+#	undef lcd_line_P
+#	undef lcd_print_P
+#	undef lcd_refresh_ml_P
+#	undef lcd_write_block_P
+#	undef lcd_put_u16
+#	undef lcd_put_u32
+#	undef lcd_put_i32
+#	undef lcd_put_fixed
+#	undef lcd_custom_char
+#	undef lcd_load_glyph_set
+#	undef lcd_read_busy_and_addr
+#	undef lcd_read_data
+
+#	if LCD_HD44780_PIN_FLASH_INFO
+#		define __LCD_DESC(_i)		(_i)
+#	else
+#		define __LCD_DESC(_i)		((const lcd_info_struct *)(_i))
+#	endif
+
+void lcd_clear(const lcd_info_t *const info) {
+	_lcd_g_clear(__LCD_DESC(info));
+}
+
+void lcd_home(const lcd_info_t *const info, const uint8_t flags) {
+	_lcd_g_home(__LCD_DESC(info), flags);
+}
+
+void lcd_entry_mode(const lcd_info_t *const info, const uint8_t flags) {
+	_lcd_g_entry_mode(__LCD_DESC(info), flags);
+}
+
+void lcd_display_ctrl(const lcd_info_t *const info, const uint8_t flags) {
+	_lcd_g_display_ctrl(__LCD_DESC(info), flags);
+}
+
+void lcd_cursor(const lcd_info_t *const info, const uint8_t flags) {
+	_lcd_g_cursor(__LCD_DESC(info), flags);
+}
+
+void lcd_func_set(const lcd_info_t *const info, const uint8_t flags) {
+	_lcd_g_func_set(__LCD_DESC(info), flags);
+}
+
+void lcd_cgr_adr(const lcd_info_t *const info, const uint8_t flags) {
+	_lcd_g_cgr_adr(__LCD_DESC(info), flags);
+}
+
+void lcd_ddr_adr(const lcd_info_t *const info, const uint8_t flags) {
+	_lcd_g_ddr_adr(__LCD_DESC(info), flags);
+}
+
+void lcd_set_pos(const lcd_info_t *const info, const lcd_line_t line, const uint8_t pos) {
+	_lcd_g_set_pos(__LCD_DESC(info), line, pos);
+}
+
+void lcd_byte(const lcd_info_t *const info, const byte_t ch) {
+	_lcd_g_byte(__LCD_DESC(info), ch);
+}
+
+void lcd_line(const lcd_info_t *const info, const char str[], const lcd_line_t line, const uint8_t start_pos) {
+	_lcd_g_line(__LCD_DESC(info), str, line, start_pos);
+}
+
+void lcd_print(const lcd_info_t *const info, const char str[]) {
+	_lcd_g_print(__LCD_DESC(info), str);
+}
+
+void lcd_refresh_ml(const lcd_info_t *const info, const char str[]) {
+	_lcd_g_refresh_ml(__LCD_DESC(info), str);
+}
+
+void lcd_write_block(const lcd_info_t *const info, const byte_t buf[], const uint8_t len) {
+	_lcd_g_write_block(__LCD_DESC(info), buf, len);
+}
+
+void lcd_write_at(const lcd_info_t *const info, const lcd_line_t line, const uint8_t pos, const byte_t buf[], const uint8_t len) {
+	_lcd_g_write_at(__LCD_DESC(info), line, pos, buf, len);
+}
+
+void lcd_line_P(const lcd_info_t *const info, const char str[], const lcd_line_t line, const uint8_t start_pos) {
+	_lcd_g_line_P(__LCD_DESC(info), str, line, start_pos);
+}
+
+void lcd_print_P(const lcd_info_t *const info, const char str[]) {
+	_lcd_g_print_P(__LCD_DESC(info), str);
+}
+
+void lcd_refresh_ml_P(const lcd_info_t *const info, const char str[]) {
+	_lcd_g_refresh_ml_P(__LCD_DESC(info), str);
+}
+
+void lcd_write_block_P(const lcd_info_t *const info, const __flash byte_t buf[], const uint8_t len) {
+	_lcd_g_write_block_P(__LCD_DESC(info), buf, len);
+}
+
+void lcd_put_u16(const lcd_info_t *const info, const uint16_t value, const uint8_t width, const char pad) {
+	_lcd_g_put_u16(__LCD_DESC(info), value, width, pad);
+}
+
+void lcd_put_u32(const lcd_info_t *const info, const uint32_t value, const uint8_t width, const char pad) {
+	_lcd_g_put_u32(__LCD_DESC(info), value, width, pad);
+}
+
+void lcd_put_i32(const lcd_info_t *const info, const int32_t value, const uint8_t width, const char pad) {
+	_lcd_g_put_i32(__LCD_DESC(info), value, width, pad);
+}
+
+void lcd_put_fixed(const lcd_info_t *const info, const int32_t value, const uint8_t frac_digits, const uint8_t width, const char pad) {
+	_lcd_g_put_fixed(__LCD_DESC(info), value, frac_digits, width, pad);
+}
+
+void lcd_custom_char(const lcd_info_t *const info, const byte_t char_pos, const byte_t custom_char[8]) {
+	_lcd_g_custom_char(__LCD_DESC(info), char_pos, custom_char);
+}
+
+void lcd_load_glyph_set(const lcd_info_t *const info, const byte_t first_slot, const __flash byte_t glyphs[][8], const uint8_t count) {
+	_lcd_g_load_glyph_set(__LCD_DESC(info), first_slot, glyphs, count);
+}
+
+byte_t lcd_read_busy_and_addr(const lcd_info_t *const info) {
+	return _lcd_g_read_busy_and_addr(__LCD_DESC(info));
+}
+
+byte_t lcd_read_data(const lcd_info_t *const info) {
+	return _lcd_g_read_data(__LCD_DESC(info));
+}
+
+#	define __LCD_BUS_ADDR				0xFF // The row address should be sent before the next symbol
+
+typedef struct {
+	const char *str; // The next symbol
+	uint8_t row;
+	uint8_t col;
+} _lcd_bus_job_t;
+
+// The same rows and padding as lcd_refresh_ml(), one byte per call
+static bool _lcd_bus_next(const __LCD_INFO_SPACE lcd_info_struct *const _info, _lcd_bus_job_t *const job, byte_t *const ch) {
+	if (job->row >= _info->row_cout) {
+		return false;
+	}
+	if (job->col == __LCD_BUS_ADDR) {
+		job->col = 0;
+		*ch = _HD44780_DDRAM | _info->row_addr[job->row];
+		return true;
+	}
+	const char symbol = *job->str;
+	if ((symbol == '\0') || (symbol == '\n')) {
+		*ch = ' ';
+	} else {
+		*ch = symbol;
+		job->str++;
+	}
+	if (++job->col == _info->col_cout) {
+		job->row++;
+		job->col = __LCD_BUS_ADDR;
+		if (symbol == '\n') {
+			job->str++; // A line break right after a full row gives an empty row
+		}
+	}
+	return true;
+}
+
+void lcd_bus_refresh_ml(const lcd_bus_t *const bus, const char *const str[]) {
+	const uint8_t count = (bus->count < LCD_HD44780_PIN_BUS_SIZE) ? bus->count : LCD_HD44780_PIN_BUS_SIZE;
+	const __LCD_INFO_SPACE lcd_info_struct *const shared = __LCD_DESC(bus->displays[0]);
+	_lcd_bus_job_t jobs[LCD_HD44780_PIN_BUS_SIZE];
+	uint8_t pending = 0;
+	uint8_t busy = 0;
+	for (uint8_t i = 0; i < count; i++) {
+		jobs[i].str = str[i];
+		jobs[i].row = 0;
+		jobs[i].col = __LCD_BUS_ADDR;
+		if (str[i]) {
+			pending |= _BV(i);
+		}
+	}
+	while (pending || busy) {
+		if (busy) { // All the busy flags by one switch of the bus direction
+			port_to_read_pu(*(shared->data_ddr), *(shared->data_port), shared->port_mask);
+			pin_off(*(shared->rs_port), shared->rs_pin);
+			pin_on(*(shared->rw_port), shared->rw_pin);
+			for (uint8_t i = 0; i < count; i++) {
+				if (flag_is_set(busy, i)) {
+					const __LCD_INFO_SPACE lcd_info_struct *const _info = __LCD_DESC(bus->displays[i]);
+					if (flag_is_clear(_lcd_read_byte(_info, flag_is_set(_info->flags, __HD44780_CONF_IDL_BIT)), __HD44780_BF_BIT)) {
+						busy &= ~_BV(i);
+					}
+				}
+			}
+			pin_off(*(shared->rw_port), shared->rw_pin);
+			port_to_write(*(shared->data_ddr), shared->port_mask);
+			pin_on(*(shared->rs_port), shared->rs_pin);// Default on - data
+		}
+		for (uint8_t i = 0; i < count; i++) {
+			if (flag_is_clear(pending, i) || flag_is_set(busy, i)) {
+				continue;
+			}
+			const __LCD_INFO_SPACE lcd_info_struct *const _info = __LCD_DESC(bus->displays[i]);
+			byte_t ch;
+			const bool is_addr = (jobs[i].col == __LCD_BUS_ADDR);
+			if (!_lcd_bus_next(_info, &jobs[i], &ch)) {
+				pending &= ~_BV(i);
+				continue;
+			}
+			if (is_addr) {
+				pin_off(*(shared->rs_port), shared->rs_pin);
+			}
+			_lcd_byte(_info, ch);
+			if (is_addr) {
+				pin_on(*(shared->rs_port), shared->rs_pin);
+			}
+			if (flag_is_set(_info->flags, __HD44780_CONF_READ_BIT)) {
+				busy |= _BV(i);
+			} else {
+				_lcd_exec_delay(is_addr ? __LCD_EXEC_CMD : __LCD_EXEC_DATA);
+			}
+		}
+	}
+}
+
+#	if LCD_HD44780_PIN_BROADCAST
+// The first display drives the data and the RS lines, the others only add their E lines
+void lcd_broadcast_init(const lcd_bus_t *const bus, const lcd_init_t *const config) {
+	_lcd_broadcast = bus;
+	_lcd_start(__LCD_DESC(bus->displays[0]), config->flags);
+	_lcd_broadcast = NULL;
+}
+
+void lcd_broadcast_line(const lcd_bus_t *const bus, const char str[], const lcd_line_t line, const uint8_t start_pos) {
+	_lcd_broadcast = bus;
+	_lcd_g_line(__LCD_DESC(bus->displays[0]), str, line, start_pos);
+	_lcd_broadcast = NULL;
+}
+
+void lcd_broadcast_custom_char(const lcd_bus_t *const bus, const byte_t char_pos, const byte_t custom_char[8]) {
+	_lcd_broadcast = bus;
+	_lcd_g_custom_char(__LCD_DESC(bus->displays[0]), char_pos, custom_char);
+	_lcd_broadcast = NULL;
+}
+#	endif // LCD_HD44780_PIN_BROADCAST
+
+#	ifdef LCD_HD44780_PIN_INSTANCES
+#		define __LCD_INSTANCE_DEFINE(_n, _type, _flags, _data, _shift, _rs, _rs_pin, _e, _e_pin, _rw, _rw_pin) \
+_Static_assert((_type) != HD44780_DISPLAY_40X4, "The 40x4 display is not supported in multidisplay mode!"); \
+const __LCD_INFO_SPACE lcd_info_struct lcd_ ## _n ## _info = LCD_HD44780_PIN_INFO(_type, _flags, _data, _shift, _rs, _rs_pin, _e, _e_pin, _rw, _rw_pin); \
+void lcd_ ## _n ## _setup(void) { \
+	PIN_TO_WRITE_D_LO(_rs, _rs_pin); \
+	PIN_TO_WRITE_D_LO(_e, _e_pin); \
+	if (__LCD_INFO_IS_READ(_flags)) { \
+		PIN_TO_WRITE_D_LO(_rw, _rw_pin); /* Default off */ \
+	} \
+	PORT_TO_WRITE(_data, lcd_ ## _n ## _info.port_mask); \
+} \
+void lcd_ ## _n ## _init(const lcd_init_t *const config) { \
+	lcd_ ## _n ## _setup(); \
+	_lcd_start(&lcd_ ## _n ## _info, config->flags); \
+} \
+void lcd_ ## _n ## _clear(void) { _lcd_g_clear(&lcd_ ## _n ## _info); } \
+void lcd_ ## _n ## _home(const uint8_t flags) { _lcd_g_home(&lcd_ ## _n ## _info, flags); } \
+void lcd_ ## _n ## _entry_mode(const uint8_t flags) { _lcd_g_entry_mode(&lcd_ ## _n ## _info, flags); } \
+void lcd_ ## _n ## _display_ctrl(const uint8_t flags) { _lcd_g_display_ctrl(&lcd_ ## _n ## _info, flags); } \
+void lcd_ ## _n ## _cursor(const uint8_t flags) { _lcd_g_cursor(&lcd_ ## _n ## _info, flags); } \
+void lcd_ ## _n ## _func_set(const uint8_t flags) { _lcd_g_func_set(&lcd_ ## _n ## _info, flags); } \
+void lcd_ ## _n ## _cgr_adr(const uint8_t flags) { _lcd_g_cgr_adr(&lcd_ ## _n ## _info, flags); } \
+void lcd_ ## _n ## _ddr_adr(const uint8_t flags) { _lcd_g_ddr_adr(&lcd_ ## _n ## _info, flags); } \
+void lcd_ ## _n ## _set_pos(const lcd_line_t line, const uint8_t pos) { _lcd_g_set_pos(&lcd_ ## _n ## _info, line, pos); } \
+void lcd_ ## _n ## _byte(const byte_t ch) { _lcd_g_byte(&lcd_ ## _n ## _info, ch); } \
+void lcd_ ## _n ## _line(const char str[], const lcd_line_t line, const uint8_t start_pos) { _lcd_g_line(&lcd_ ## _n ## _info, str, line, start_pos); } \
+void lcd_ ## _n ## _print(const char str[]) { _lcd_g_print(&lcd_ ## _n ## _info, str); } \
+void lcd_ ## _n ## _refresh_ml(const char str[]) { _lcd_g_refresh_ml(&lcd_ ## _n ## _info, str); } \
+void lcd_ ## _n ## _write_block(const byte_t buf[], const uint8_t len) { _lcd_g_write_block(&lcd_ ## _n ## _info, buf, len); } \
+void lcd_ ## _n ## _write_at(const lcd_line_t line, const uint8_t pos, const byte_t buf[], const uint8_t len) { _lcd_g_write_at(&lcd_ ## _n ## _info, line, pos, buf, len); } \
+void lcd_ ## _n ## _line_P(const char str[], const lcd_line_t line, const uint8_t start_pos) { _lcd_g_line_P(&lcd_ ## _n ## _info, str, line, start_pos); } \
+void lcd_ ## _n ## _print_P(const char str[]) { _lcd_g_print_P(&lcd_ ## _n ## _info, str); } \
+void lcd_ ## _n ## _refresh_ml_P(const char str[]) { _lcd_g_refresh_ml_P(&lcd_ ## _n ## _info, str); } \
+void lcd_ ## _n ## _write_block_P(const __flash byte_t buf[], const uint8_t len) { _lcd_g_write_block_P(&lcd_ ## _n ## _info, buf, len); } \
+void lcd_ ## _n ## _put_u16(const uint16_t value, const uint8_t width, const char pad) { _lcd_g_put_u16(&lcd_ ## _n ## _info, value, width, pad); } \
+void lcd_ ## _n ## _put_u32(const uint32_t value, const uint8_t width, const char pad) { _lcd_g_put_u32(&lcd_ ## _n ## _info, value, width, pad); } \
+void lcd_ ## _n ## _put_i32(const int32_t value, const uint8_t width, const char pad) { _lcd_g_put_i32(&lcd_ ## _n ## _info, value, width, pad); } \
+void lcd_ ## _n ## _put_fixed(const int32_t value, const uint8_t frac_digits, const uint8_t width, const char pad) { _lcd_g_put_fixed(&lcd_ ## _n ## _info, value, frac_digits, width, pad); } \
+void lcd_ ## _n ## _custom_char(const byte_t char_pos, const byte_t custom_char[8]) { _lcd_g_custom_char(&lcd_ ## _n ## _info, char_pos, custom_char); } \
+void lcd_ ## _n ## _load_glyph_set(const byte_t first_slot, const __flash byte_t glyphs[][8], const uint8_t count) { _lcd_g_load_glyph_set(&lcd_ ## _n ## _info, first_slot, glyphs, count); } \
+byte_t lcd_ ## _n ## _read_busy_and_addr(void) { return _lcd_g_read_busy_and_addr(&lcd_ ## _n ## _info); } \
+byte_t lcd_ ## _n ## _read_data(void) { return _lcd_g_read_data(&lcd_ ## _n ## _info); }
+
+LCD_HD44780_PIN_INSTANCES(__LCD_INSTANCE_DEFINE)
+#	endif // LCD_HD44780_PIN_INSTANCES
+#endif // LCD_HD44780_PIN_MULTI_MODE
@@ -0,0 +1,118 @@
+// ---------------------------------------------------------------------------+
+//					This file is part of SLS AVR Library
+//				https://github.com/SimonLitt/sls-avr-lib
+// ---------------------------------------------------------------------------+
+// Copyright (C) 2025 Simon Litt <simon@1itt.net> https://coding.1itt.net,
+// 												  https://github.com/SimonLitt
+//
+// This program is free software: you can redistribute it and/or modify it
+// under the terms of the GNU General Public License as published by the Free
+// Software Foundation, version 3.
+//
+// This program is distributed in the hope that it will be useful, but WITHOUT
+// ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+// FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License for
+// more details.
+//
+// You should have received a copy of the GNU General Public License along
+// with this program. If not, see <https://www.gnu.org/licenses/>.
+// ---------------------------------------------------------------------------+
+#include <sls-avr/lcd_marquee.h>
+#include <avr/pgmspace.h>
+
+#if !LCD_HD44780_PIN_MULTI_MODE
+#	if __LCD_MULTIMODE_INFO_ROWS(info) > 2
+#		error "The display shift scrolling is supported only by 1 and 2 row displays!"
+#	endif
+#endif
+#define __MARQ_ROW_LEN			((__LCD_MULTIMODE_INFO_ROWS(info) == 1) ? 80 : 40) // The display shift wraps over a DDRAM row
+
+static uint8_t _lcd_marquee_text(__LCD_MULTIMODE_ONLY_INFO_ARG_WITH_COMMA(info) const lcd_line_t line, const char str[], const bool is_pgm) {
+	#if LCD_HD44780_PIN_MULTI_MODE
+		if (__LCD_MULTIMODE_INFO_ROWS(info) > 2) {
+			return 0;
+		}
+	#endif
+	const uint8_t row_len = __MARQ_ROW_LEN;
+	uint8_t len = 0;
+	lcd_set_pos(__LCD_MULTIMODE_ONLY_VAR_WITH_COMMA(info) line, 0);
+	for (uint8_t pos = 0; pos < row_len; pos++) {
+		const char ch = (len == pos) ? (is_pgm ? pgm_read_byte(&str[pos]) : str[pos]) : '\0';
+		if (ch != '\0') {
+			lcd_byte(__LCD_MULTIMODE_ONLY_VAR_WITH_COMMA(info) ch);
+			len++;
+		} else {
+			lcd_byte(__LCD_MULTIMODE_ONLY_VAR_WITH_COMMA(info) ' ');
+		}
+	}
+	return len;
+}
+
+uint8_t lcd_marquee_text(__LCD_MULTIMODE_ONLY_INFO_ARG_WITH_COMMA(info) const lcd_line_t line, const char str[]) {
+	return _lcd_marquee_text(__LCD_MULTIMODE_ONLY_VAR_WITH_COMMA(info) line, str, false);
+}
+
+uint8_t lcd_marquee_text_P(__LCD_MULTIMODE_ONLY_INFO_ARG_WITH_COMMA(info) const lcd_line_t line, const char str[]) {
+	return _lcd_marquee_text(__LCD_MULTIMODE_ONLY_VAR_WITH_COMMA(info) line, str, true);
+}
+
+void lcd_marquee_start(__LCD_MULTIMODE_ONLY_INFO_ARG_WITH_COMMA(info) lcd_marquee_t *const marquee, const uint8_t len, const lcd_marquee_mode_t mode, const uint8_t period) {
+	lcd_home(__LCD_MULTIMODE_ONLY_VAR_WITH_COMMA(info) 0); // Also resets the display shift
+	marquee->period = period;
+	marquee->ticks = 0;
+	marquee->mode = mode;
+	marquee->shift = 0;
+	marquee->back = false;
+	#if LCD_HD44780_PIN_MULTI_MODE
+		if (__LCD_MULTIMODE_INFO_ROWS(info) > 2) {
+			marquee->span = 0; // Keeps the text still
+			return;
+		}
+	#endif
+	if (mode == LCD_MARQUEE_WRAP) {
+		marquee->span = __MARQ_ROW_LEN;
+	} else {
+		const uint8_t cols = __LCD_MULTIMODE_INFO_COLS(info);
+		marquee->span = (len > cols) ? (len - cols) : 0;
+	}
+}
+
+void lcd_marquee_step(__LCD_MULTIMODE_ONLY_INFO_ARG_WITH_COMMA(info) lcd_marquee_t *const marquee) {
+	if (!marquee->span) {
+		return;
+	}
+	if (!marquee->back) {
+		lcd_cursor(__LCD_MULTIMODE_ONLY_VAR_WITH_COMMA(info) HD44780_SCN_DISP | HD44780_RL_LEFT);
+		marquee->shift++;
+		if (marquee->shift == marquee->span) {
+			if (marquee->mode == LCD_MARQUEE_WRAP) {
+				marquee->shift = 0; // The controller is back at the start of the row
+			} else {
+				marquee->back = true;
+			}
+		}
+	} else {
+		lcd_cursor(__LCD_MULTIMODE_ONLY_VAR_WITH_COMMA(info) HD44780_SCN_DISP | HD44780_RL_RIGHT);
+		marquee->shift--;
+		if (!marquee->shift) {
+			marquee->back = false;
+		}
+	}
+}
+
+bool lcd_marquee_tick(__LCD_MULTIMODE_ONLY_INFO_ARG_WITH_COMMA(info) lcd_marquee_t *const marquee) {
+	marquee->ticks++;
+	if (marquee->ticks < marquee->period) {
+		return false;
+	}
+	marquee->ticks = 0;
+	lcd_marquee_step(__LCD_MULTIMODE_ONLY_VAR_WITH_COMMA(info) marquee);
+	return marquee->span != 0;
+}
+
+void lcd_marquee_stop(__LCD_MULTIMODE_ONLY_INFO_ARG_WITH_COMMA(info) lcd_marquee_t *const marquee) {
+	marquee->span = 0;
+	marquee->shift = 0;
+	marquee->back = false;
+	lcd_home(__LCD_MULTIMODE_ONLY_VAR_WITH_COMMA(info) 0);
+}
@@ -0,0 +1,183 @@
+// ---------------------------------------------------------------------------+
+//					This file is part of SLS AVR Library
+//				https://github.com/SimonLitt/sls-avr-lib
+// ---------------------------------------------------------------------------+
+// Copyright (C) 2025 Simon Litt <simon@1itt.net> https://coding.1itt.net,
+// 												  https://github.com/SimonLitt
+//
+// This program is free software: you can redistribute it and/or modify it
+// under the terms of the GNU General Public License as published by the Free
+// Software Foundation, version 3.
+//
+// This program is distributed in the hope that it will be useful, but WITHOUT
+// ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+// FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License for
+// more details.
+//
+// You should have received a copy of the GNU General Public License along
+// with this program. If not, see <https://www.gnu.org/licenses/>.
+// ---------------------------------------------------------------------------+
+#include <sls-avr/lcd_stdio.h>
+
+#if LCD_HD44780_PIN_MULTI_MODE
+#	define __STDIO_INFO			stream->info,
+#	define __STDIO_INFO_ONLY	stream->info
+#else
+#	define __STDIO_INFO
+#	define __STDIO_INFO_ONLY
+#endif
+
+#define __STDIO_ESC				0x1B
+
+// Escape sequence states
+#define __STDIO_ESC_NONE		0
+#define __STDIO_ESC_START		1 // ESC received
+#define __STDIO_ESC_CSI			2 // ESC [ received, the first number goes
+#define __STDIO_ESC_CSI_2		3 // The second number goes
+
+#define __STDIO_NO_CR			0xFF // The previous symbol is not \r
+
+static int _lcd_stream_put(char ch, FILE *file);
+
+FILE *lcd_stream_open(__LCD_MULTIMODE_ONLY_INFO_ARG_WITH_COMMA(info) lcd_stream_t *const stream) {
+	#if LCD_HD44780_PIN_MULTI_MODE
+		stream->info = _info;
+	#endif
+	stream->rows = __LCD_MULTIMODE_INFO_ROWS(info);
+	stream->cols = __LCD_MULTIMODE_INFO_COLS(info);
+	stream->row = 0;
+	stream->col = 0;
+	stream->len = 0;
+	stream->esc = __STDIO_ESC_NONE;
+	stream->cr_col = __STDIO_NO_CR;
+	fdev_setup_stream(&stream->file, _lcd_stream_put, NULL, _FDEV_SETUP_WRITE);
+	fdev_set_udata(&stream->file, stream);
+	return &stream->file;
+}
+
+void lcd_stream_flush(lcd_stream_t *const stream) {
+	if (stream->len) {
+		lcd_write_at(__STDIO_INFO (lcd_line_t)stream->row, stream->col - stream->len, stream->buf, stream->len);
+		stream->len = 0;
+	}
+}
+
+// Erases the columns from..to-1 of the cursor row
+static void _lcd_stream_erase(lcd_stream_t *const stream, const uint8_t from, uint8_t to) {
+	lcd_stream_flush(stream);
+	if (to > stream->cols) {
+		to = stream->cols;
+	}
+	if (from < to) {
+		lcd_set_pos(__STDIO_INFO (lcd_line_t)stream->row, from);
+		for (uint8_t col = from; col < to; col++) {
+			lcd_byte(__STDIO_INFO ' ');
+		}
+	}
+}
+
+static void _lcd_stream_move(lcd_stream_t *const stream, const uint8_t row, const uint8_t col) {
+	lcd_stream_flush(stream);
+	stream->row = (row < stream->rows) ? row : (stream->rows - 1);
+	stream->col = (col < stream->cols) ? col : (stream->cols - 1);
+}
+
+static void _lcd_stream_new_line(lcd_stream_t *const stream) {
+	_lcd_stream_move(stream, (stream->row + 1 < stream->rows) ? (stream->row + 1) : 0, 0);
+}
+
+static void _lcd_stream_clear(lcd_stream_t *const stream) {
+	stream->len = 0;
+	stream->row = 0;
+	stream->col = 0;
+	lcd_clear(__STDIO_INFO_ONLY);
+}
+
+// Executes the final symbol of an escape sequence
+static void _lcd_stream_csi(lcd_stream_t *const stream, const char ch) {
+	switch (ch) {
+		case 'H':
+		case 'f':
+			_lcd_stream_move(stream, stream->args[0] ? (stream->args[0] - 1) : 0, stream->args[1] ? (stream->args[1] - 1) : 0);
+			break;
+		case 'K':
+			switch (stream->args[0]) {
+				case 0:
+					_lcd_stream_erase(stream, stream->col, stream->cols);
+					break;
+				case 1:
+					_lcd_stream_erase(stream, 0, stream->col + 1); // The cursor cell too
+					break;
+				case 2:
+					_lcd_stream_erase(stream, 0, stream->cols);
+					break;
+			}
+			break;
+		case 'J':
+			if (stream->args[0] == 2) {
+				_lcd_stream_clear(stream);
+			}
+			break;
+		default:
+			break; // Not supported
+	}
+}
+
+static int _lcd_stream_put(char ch, FILE *file) {
+	lcd_stream_t *const stream = (lcd_stream_t *)fdev_get_udata(file);
+	if (stream->esc != __STDIO_ESC_NONE) {
+		if (stream->esc == __STDIO_ESC_START) {
+			if (ch == '[') {
+				stream->esc = __STDIO_ESC_CSI;
+				stream->args[0] = 0;
+				stream->args[1] = 0;
+			} else {
+				stream->esc = __STDIO_ESC_NONE;
+			}
+		} else if ((ch >= '0') && (ch <= '9')) {
+			uint8_t *const arg = &stream->args[stream->esc - __STDIO_ESC_CSI];
+			const uint16_t value = (uint16_t)*arg * 10 + (ch - '0');
+			*arg = (value < 0xFF) ? value : 0xFF; // Saturates, the position is limited by the display later
+		} else if (ch == ';') {
+			stream->esc = __STDIO_ESC_CSI_2;
+		} else {
+			stream->esc = __STDIO_ESC_NONE;
+			_lcd_stream_csi(stream, ch);
+		}
+		return 0;
+	}
+	const uint8_t cr_col = stream->cr_col;
+	stream->cr_col = __STDIO_NO_CR;
+	switch (ch) {
+		case '\n':
+			_lcd_stream_erase(stream, (cr_col != __STDIO_NO_CR) ? cr_col : stream->col, stream->cols); // \r\n ends the line as \n alone
+			_lcd_stream_new_line(stream);
+			break;
+		case '\r':
+			stream->cr_col = stream->col;
+			_lcd_stream_move(stream, stream->row, 0);
+			break;
+		case '\b':
+			if (stream->col) {
+				_lcd_stream_move(stream, stream->row, stream->col - 1);
+			}
+			break;
+		case '\f':
+			_lcd_stream_clear(stream);
+			break;
+		case __STDIO_ESC:
+			lcd_stream_flush(stream);
+			stream->esc = __STDIO_ESC_START;
+			break;
+		default:
+			if (stream->col >= stream->cols) {
+				_lcd_stream_new_line(stream);
+			} else if (stream->len == LCD_STDIO_BUF_SIZE) {
+				lcd_stream_flush(stream);
+			}
+			stream->buf[stream->len++] = ch;
+			stream->col++;
+			break;
+	}
+	return 0;
+}
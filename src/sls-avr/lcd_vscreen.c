@@ -0,0 +1,98 @@
+// ---------------------------------------------------------------------------+
+//					This file is part of SLS AVR Library
+//				https://github.com/SimonLitt/sls-avr-lib
+// ---------------------------------------------------------------------------+
+// Copyright (C) 2025 Simon Litt <simon@1itt.net> https://coding.1itt.net,
+// 												  https://github.com/SimonLitt
+//
+// This program is free software: you can redistribute it and/or modify it
+// under the terms of the GNU General Public License as published by the Free
+// Software Foundation, version 3.
+//
+// This program is distributed in the hope that it will be useful, but WITHOUT
+// ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+// FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License for
+// more details.
+//
+// You should have received a copy of the GNU General Public License along
+// with this program. If not, see <https://www.gnu.org/licenses/>.
+// ---------------------------------------------------------------------------+
+#include <sls-avr/lcd_vscreen.h>
+#include <string.h>
+
+void lcd_vscreen_init(__LCD_MULTIMODE_ONLY_INFO_ARG_WITH_COMMA(info) lcd_vscreen_t *const vscreen, byte_t cells[], const uint8_t width, const uint8_t height, byte_t panel[]) {
+	vscreen->cells = cells;
+	vscreen->panel = panel;
+	vscreen->width = width;
+	vscreen->height = height;
+	vscreen->rows = __LCD_MULTIMODE_INFO_ROWS(info);
+	vscreen->cols = __LCD_MULTIMODE_INFO_COLS(info);
+	vscreen->top = 0;
+	vscreen->left = 0;
+	vscreen->valid = false;
+	lcd_vscreen_clear(vscreen);
+}
+
+void lcd_vscreen_clear(lcd_vscreen_t *const vscreen) {
+	memset(vscreen->cells, ' ', (uint16_t)vscreen->width * vscreen->height);
+}
+
+void lcd_vscreen_text(lcd_vscreen_t *const vscreen, const uint8_t row, const uint8_t col, const char str[]) {
+	if (row >= vscreen->height) {
+		return;
+	}
+	byte_t *dst = &vscreen->cells[(uint16_t)row * vscreen->width];
+	for (uint8_t pos = col; (pos < vscreen->width) && (*str != '\0'); pos++) {
+		dst[pos] = *str++;
+	}
+}
+
+void lcd_vscreen_line(lcd_vscreen_t *const vscreen, const uint8_t row, const char str[]) {
+	if (row >= vscreen->height) {
+		return;
+	}
+	byte_t *dst = &vscreen->cells[(uint16_t)row * vscreen->width];
+	for (uint8_t pos = 0; pos < vscreen->width; pos++) {
+		dst[pos] = (*str != '\0') ? *str++ : ' ';
+	}
+}
+
+void lcd_vscreen_redraw(__LCD_MULTIMODE_ONLY_INFO_ARG_WITH_COMMA(info) lcd_vscreen_t *const vscreen) {
+	const uint8_t cols = vscreen->cols;
+	const bool valid = vscreen->valid;
+	for (uint8_t row = 0; row < vscreen->rows; row++) {
+		const byte_t *src = &vscreen->cells[(uint16_t)(vscreen->top + row) * vscreen->width + vscreen->left];
+		if (!vscreen->panel) {
+			lcd_write_at(__LCD_MULTIMODE_ONLY_VAR_WITH_COMMA(info) (lcd_line_t)row, 0, src, cols); // The shadow buffer of the driver drops the same cells
+			continue;
+		}
+		byte_t *dst = &vscreen->panel[row * cols];
+		uint8_t col = 0;
+		while (col < cols) {
+			if (valid && (src[col] == dst[col])) {
+				col++;
+				continue;
+			}
+			lcd_set_pos(__LCD_MULTIMODE_ONLY_VAR_WITH_COMMA(info) (lcd_line_t)row, col);
+			// A single same cell inside a run is sent too, it costs as much as the address command
+			while ((col < cols) && (!valid || (src[col] != dst[col]) || ((col + 1 < cols) && (src[col + 1] != dst[col + 1])))) {
+				dst[col] = src[col];
+				lcd_byte(__LCD_MULTIMODE_ONLY_VAR_WITH_COMMA(info) src[col]);
+				col++;
+			}
+		}
+	}
+	vscreen->valid = true;
+}
+
+void lcd_vscreen_view(__LCD_MULTIMODE_ONLY_INFO_ARG_WITH_COMMA(info) lcd_vscreen_t *const vscreen, const uint8_t top, const uint8_t left) {
+	const uint8_t max_top = (vscreen->height > vscreen->rows) ? (vscreen->height - vscreen->rows) : 0;
+	const uint8_t max_left = (vscreen->width > vscreen->cols) ? (vscreen->width - vscreen->cols) : 0;
+	vscreen->top = (top < max_top) ? top : max_top;
+	vscreen->left = (left < max_left) ? left : max_left;
+	lcd_vscreen_redraw(__LCD_MULTIMODE_ONLY_VAR_WITH_COMMA(info) vscreen);
+}
+
+void lcd_vscreen_invalidate(lcd_vscreen_t *const vscreen) {
+	vscreen->valid = false;
+}